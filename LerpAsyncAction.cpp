@@ -0,0 +1,169 @@
+#include "LerpAsyncAction.h"
+#include "LerpLibrary.h"
+#include "LerpSubsystem.h"
+
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+ULerpAsyncAction* ULerpAsyncAction::Create(UObject* WorldContextObject, TFunction<FLerpHandle()> StartLerp)
+{
+    ULerpAsyncAction* Action = NewObject<ULerpAsyncAction>();
+    Action->StartLerp = MoveTemp(StartLerp);
+    Action->WorldContext = WorldContextObject;
+    if (WorldContextObject)
+    {
+        Action->RegisterWithGameInstance(WorldContextObject);
+    }
+    return Action;
+}
+
+void ULerpAsyncAction::Activate()
+{
+    Handle = StartLerp ? StartLerp() : FLerpHandle();
+    StartLerp = nullptr;
+
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContext.Get());
+    const FDelegateHandle ListenerHandle = LerpSubsystem ? LerpSubsystem->AddTweenListener(
+        Handle,
+        FOnLerpTweenUpdate::CreateUObject(this, &ULerpAsyncAction::HandleUpdate),
+        FOnLerpTweenFinished::CreateUObject(this, &ULerpAsyncAction::HandleFinished)) : FDelegateHandle();
+
+    // 参数无效没能启动，或等待的lerp已经结束。同一句柄上的多个节点各自监听，互不覆盖
+    if (!ListenerHandle.IsValid())
+    {
+        OnCancelled.Broadcast(Handle, 0.0f);
+        SetReadyToDestroy();
+    }
+}
+
+void ULerpAsyncAction::HandleUpdate(float Progress)
+{
+    LastProgress = Progress;
+    OnUpdate.Broadcast(Handle, Progress);
+}
+
+void ULerpAsyncAction::HandleFinished(ELerpFinishReason Reason)
+{
+    if (Reason == ELerpFinishReason::Completed)
+    {
+        OnComplete.Broadcast(Handle, 1.0f);
+    }
+    else
+    {
+        OnCancelled.Broadcast(Handle, LastProgress);
+    }
+    SetReadyToDestroy();
+}
+
+ULerpAsyncAction* ULerpAsyncAction::WaitForLerp(UObject* WorldContextObject, FLerpHandle Handle)
+{
+    return Create(WorldContextObject, [Handle]()
+    {
+        return Handle;
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::MoveActorToLocationAsync(AActor* Actor, FVector TargetLocation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(Actor, [=]()
+    {
+        return ULerpLibrary::MoveActorToLocation(Actor, TargetLocation, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::MoveComponentToLocationAsync(USceneComponent* Component, FVector TargetLocation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(Component, [=]()
+    {
+        return ULerpLibrary::MoveComponentToLocation(Component, TargetLocation, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::MoveComponentToLocationWithVectorCurveAsync(USceneComponent* Component, FVector TargetLocation, float Duration, UCurveVector* Curve, ELerpConflict Conflict)
+{
+    return Create(Component, [=]()
+    {
+        return ULerpLibrary::MoveComponentToLocationWithVectorCurve(Component, TargetLocation, Duration, Curve, Conflict);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::RotateActorToRotationAsync(AActor* Actor, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(Actor, [=]()
+    {
+        return ULerpLibrary::RotateActorToRotation(Actor, TargetRotation, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::RotateComponentToRotationAsync(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(Component, [=]()
+    {
+        return ULerpLibrary::RotateComponentToRotation(Component, TargetRotation, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::RotateComponentToRelativeRotationAsync(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(Component, [=]()
+    {
+        return ULerpLibrary::RotateComponentToRelativeRotation(Component, TargetRotation, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::ScaleActorToScaleAsync(AActor* Actor, FVector TargetScale, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(Actor, [=]()
+    {
+        return ULerpLibrary::ScaleActorToScale(Actor, TargetScale, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::LerpFloatPropertyAsync(UObject* Target, FString PropertyPath, float TargetValue, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(Target, [=]()
+    {
+        return ULerpLibrary::LerpFloatProperty(Target, PropertyPath, TargetValue, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::LerpFloatWithSetterAsync(UObject* WorldContextObject, float StartValue, float TargetValue, float Duration, const FLerpFloatSetter& Setter, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(WorldContextObject, [=]()
+    {
+        return ULerpLibrary::LerpFloatWithSetter(WorldContextObject, StartValue, TargetValue, Duration, Setter, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::LerpMaterialScalarParameterAsync(UObject* WorldContextObject, UMaterialInstanceDynamic* Material, FName ParameterName, float TargetValue, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(WorldContextObject, [=]()
+    {
+        return ULerpLibrary::LerpMaterialScalarParameter(WorldContextObject, Material, ParameterName, TargetValue, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::MoveComponentToDynamicLocationAsync(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(ComponentToMove, [=]()
+    {
+        return ULerpLibrary::MoveComponentToDynamicLocation(ParentComponent, ComponentToMove, SocketName, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::MoveComponentToSocketLocationAsync(USceneComponent* AComponent, USceneComponent* BComponent, FName SocketName, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(AComponent, [=]()
+    {
+        return ULerpLibrary::MoveComponentToSocketLocation(AComponent, BComponent, SocketName, Duration, Conflict, Ease, EaseCurve);
+    });
+}
+
+ULerpAsyncAction* ULerpAsyncAction::MoveComponentToZeroWithLerpAsync(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return Create(ComponentToMove, [=]()
+    {
+        return ULerpLibrary::MoveComponentToZeroWithLerp(ParentComponent, ComponentToMove, Duration, Conflict, Ease, EaseCurve);
+    });
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "LerpTypes.h"
+#include "LerpAsyncAction.generated.h"
+
+class UCurveFloat;
+class UCurveVector;
+class UMaterialInstanceDynamic;
+class ULerpSubsystem;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FLerpAsyncActionPin, FLerpHandle, Handle, float, Progress);
+
+// ULerpLibrary各启动函数的异步节点版本：OnUpdate每次推进后触发（弹簧的Progress总是0），结束时按原因触发OnComplete或OnCancelled。
+// 事件由子系统在帧末统一派发，不再需要自己开定时器轮询
+UCLASS()
+class LUXUN2024_API ULerpAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintAssignable)
+    FLerpAsyncActionPin OnUpdate;
+
+    UPROPERTY(BlueprintAssignable)
+    FLerpAsyncActionPin OnComplete;
+
+    // 被取消、被替换或目标被销毁
+    UPROPERTY(BlueprintAssignable)
+    FLerpAsyncActionPin OnCancelled;
+
+    // 等待已经启动的lerp，适用于任何返回FLerpHandle的函数（如LerpFloatProperty）
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static ULerpAsyncAction* WaitForLerp(UObject* WorldContextObject, FLerpHandle Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* MoveActorToLocationAsync(AActor* Actor, FVector TargetLocation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* MoveComponentToLocationAsync(USceneComponent* Component, FVector TargetLocation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* MoveComponentToLocationWithVectorCurveAsync(USceneComponent* Component, FVector TargetLocation, float Duration, UCurveVector* Curve, ELerpConflict Conflict = ELerpConflict::Replace);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* RotateActorToRotationAsync(AActor* Actor, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* RotateComponentToRotationAsync(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* RotateComponentToRelativeRotationAsync(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* ScaleActorToScaleAsync(AActor* Actor, FVector TargetScale, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* LerpFloatPropertyAsync(UObject* Target, FString PropertyPath, float TargetValue, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static ULerpAsyncAction* LerpFloatWithSetterAsync(UObject* WorldContextObject, float StartValue, float TargetValue, float Duration, const FLerpFloatSetter& Setter, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static ULerpAsyncAction* LerpMaterialScalarParameterAsync(UObject* WorldContextObject, UMaterialInstanceDynamic* Material, FName ParameterName, float TargetValue, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* MoveComponentToDynamicLocationAsync(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* MoveComponentToSocketLocationAsync(USceneComponent* AComponent, USceneComponent* BComponent, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp|Async", meta = (BlueprintInternalUseOnly = "true"))
+    static ULerpAsyncAction* MoveComponentToZeroWithLerpAsync(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    virtual void Activate() override;
+
+private:
+    // 节点激活时才真正启动lerp
+    static ULerpAsyncAction* Create(UObject* WorldContextObject, TFunction<FLerpHandle()> StartLerp);
+
+    void HandleUpdate(float Progress);
+    void HandleFinished(ELerpFinishReason Reason);
+
+    TFunction<FLerpHandle()> StartLerp;
+    TWeakObjectPtr<UObject> WorldContext;
+    FLerpHandle Handle;
+    float LastProgress = 0.0f;
+};
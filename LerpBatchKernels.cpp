@@ -0,0 +1,77 @@
+#include "LerpCore/LerpCoreKernels.h"
+
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// 在引擎实际使用的SIMD实现上对比内核与逐个调用FMath::Lerp的结果：推进和线性插值逐位相同，Slerp在舍入误差以内。
+// 不依赖引擎的标量实现另由LerpCore的LerpCoreTests覆盖。Automation RunTests LerpLibrary.Kernels
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLerpBatchKernelsTest, "LerpLibrary.Kernels.MatchScalarPath", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FLerpBatchKernelsTest::RunTest(const FString& Parameters)
+{
+    // 覆盖不足4个、恰好4的倍数和带尾部的行数
+    for (const int32 Num : { 1, 2, 3, 4, 5, 7, 8, 1027 })
+    {
+        FRandomStream Random(Num);
+
+        TArray<float> Elapsed, ExpectedElapsed, Deltas, Durations, Alphas, Starts, Ends, Floats;
+        TArray<FVector> VectorStarts, VectorEnds, Vectors;
+        TArray<FQuat> QuatStarts, QuatEnds, Quats;
+        for (TArray<float>* Column : { &Elapsed, &ExpectedElapsed, &Deltas, &Durations, &Alphas, &Starts, &Ends, &Floats })
+        {
+            Column->SetNumUninitialized(Num);
+        }
+        VectorStarts.SetNumUninitialized(Num);
+        VectorEnds.SetNumUninitialized(Num);
+        Vectors.SetNumUninitialized(Num);
+        QuatStarts.SetNumUninitialized(Num);
+        QuatEnds.SetNumUninitialized(Num);
+        Quats.SetNumUninitialized(Num);
+
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Durations[Index] = Random.FRandRange(0.01f, 5.0f);
+            // 包括延迟中（负数）和已经越过时长的行
+            Elapsed[Index] = ExpectedElapsed[Index] = Random.FRandRange(-1.0f, Durations[Index] * 1.2f);
+            Deltas[Index] = Random.FRandRange(0.0f, 0.1f);
+            Starts[Index] = Random.FRandRange(-1000.0f, 1000.0f);
+            Ends[Index] = Random.FRandRange(-1000.0f, 1000.0f);
+            VectorStarts[Index] = Random.VRand() * Random.FRandRange(0.0f, 100000.0f);
+            VectorEnds[Index] = Random.VRand() * Random.FRandRange(0.0f, 100000.0f);
+            QuatStarts[Index] = FQuat(Random.VRand(), Random.FRandRange(-PI, PI));
+            QuatEnds[Index] = FQuat(Random.VRand(), Random.FRandRange(-PI, PI));
+        }
+
+        LerpBatchKernels::AdvanceAlphas(Elapsed.GetData(), Deltas.GetData(), Durations.GetData(), Alphas.GetData(), Num);
+        LerpBatchKernels::LerpFloats(Starts.GetData(), Ends.GetData(), Alphas.GetData(), Floats.GetData(), Num);
+        LerpBatchKernels::LerpVectors(VectorStarts.GetData(), VectorEnds.GetData(), Alphas.GetData(), Vectors.GetData(), Num);
+        LerpBatchKernels::SlerpQuats(QuatStarts.GetData(), QuatEnds.GetData(), Alphas.GetData(), Quats.GetData(), Num, 0.0f);
+
+        int32 AlphaMismatches = 0;
+        int32 FloatMismatches = 0;
+        int32 VectorMismatches = 0;
+        int32 QuatMismatches = 0;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            ExpectedElapsed[Index] += Deltas[Index];
+            const float ExpectedAlpha = FMath::Clamp(ExpectedElapsed[Index] / Durations[Index], 0.0f, 1.0f);
+            AlphaMismatches += Elapsed[Index] != ExpectedElapsed[Index] || Alphas[Index] != ExpectedAlpha ? 1 : 0;
+            FloatMismatches += Floats[Index] != FMath::Lerp(Starts[Index], Ends[Index], Alphas[Index]) ? 1 : 0;
+            VectorMismatches += Vectors[Index] != FMath::Lerp(VectorStarts[Index], VectorEnds[Index], Alphas[Index]) ? 1 : 0;
+
+            // Slerp只要求误差在舍入范围内
+            QuatMismatches += Quats[Index].AngularDistance(FQuat::Slerp(QuatStarts[Index], QuatEnds[Index], Alphas[Index])) > KINDA_SMALL_NUMBER ? 1 : 0;
+        }
+
+        TestEqual(FString::Printf(TEXT("AdvanceAlphas differs from the scalar path (%d rows)"), Num), AlphaMismatches, 0);
+        TestEqual(FString::Printf(TEXT("LerpFloats differs from FMath::Lerp (%d rows)"), Num), FloatMismatches, 0);
+        TestEqual(FString::Printf(TEXT("LerpVectors differs from FMath::Lerp (%d rows)"), Num), VectorMismatches, 0);
+        TestEqual(FString::Printf(TEXT("SlerpQuats exceeds tolerance against FQuat::Slerp (%d rows)"), Num), QuatMismatches, 0);
+    }
+
+    return true;
+}
+
+#endif
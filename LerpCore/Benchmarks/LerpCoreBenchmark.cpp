@@ -0,0 +1,417 @@
+#include "../LerpCorePlatform.h"
+
+// 只在独立构建时编译；引擎内编译这个文件为空
+#if LERP_CORE_STANDALONE
+
+#include "../LerpCoreStep.h"
+#include "../LerpCoreKernels.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+
+// LerpCore的吞吐基准：按tween数、种类、缓动、单/多线程组合，测启动、每帧推进、结束回收的耗时和每个tween占用的内存。
+// 每帧推进与ULerpSubsystem相同：GatherStep、AdvanceTweens、插值内核，结果写入一个输出数组代替组件写回（不含组件本身的开销）。
+//
+//     LerpCoreBenchmark [--frames=N] [--max-count=N] [--csv]
+
+namespace
+{
+    using FClock = std::chrono::steady_clock;
+
+    double SecondsSince(FClock::time_point Start)
+    {
+        return std::chrono::duration<double>(FClock::now() - Start).count();
+    }
+
+    // 与引擎中各种类tween的列对应，只去掉UObject相关的列
+    struct FBenchVectorTweens : public FLerpTweenColumns
+    {
+        TArray<FVector> Starts;
+        TArray<FVector> Ends;
+
+        template <typename FuncType>
+        void ForEachColumn(FuncType&& Func)
+        {
+            Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+            Func(Starts); Func(Ends);
+        }
+    };
+
+    struct FBenchQuatTweens : public FLerpTweenColumns
+    {
+        TArray<FQuat> Starts;
+        TArray<FQuat> Ends;
+
+        template <typename FuncType>
+        void ForEachColumn(FuncType&& Func)
+        {
+            Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+            Func(Starts); Func(Ends);
+        }
+    };
+
+    struct FBenchScalarTweens : public FLerpTweenColumns
+    {
+        TArray<float> Starts;
+        TArray<float> Ends;
+
+        template <typename FuncType>
+        void ForEachColumn(FuncType&& Func)
+        {
+            Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+            Func(Starts); Func(Ends);
+        }
+    };
+
+    // 跟随Socket：目标每帧移动，写回时按行查共享的目标位置
+    struct FBenchFollowTweens : public FLerpTweenColumns
+    {
+        TArray<int32> SocketTargets;
+        TArray<FVector> Starts;
+
+        template <typename FuncType>
+        void ForEachColumn(FuncType&& Func)
+        {
+            Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+            Func(SocketTargets); Func(Starts);
+        }
+    };
+
+    // 跟随tween共用的Socket数
+    constexpr int32 NumSockets = 64;
+
+    FVector RandomVector(std::mt19937& Random)
+    {
+        std::uniform_real_distribution<double> Distribution(-10000.0, 10000.0);
+        return FVector(Distribution(Random), Distribution(Random), Distribution(Random));
+    }
+
+    FQuat RandomQuat(std::mt19937& Random)
+    {
+        const FVector Axis = RandomVector(Random);
+        return FQuat(Axis / Axis.Size(), std::uniform_real_distribution<double>(-UE_PI, UE_PI)(Random));
+    }
+
+    // 每种tween的填行和插值，插值结果写到Outputs。Fill生成随机数据，CopyRow在计时的启动阶段照抄，不把随机数的开销算进去
+    struct FVectorKind
+    {
+        using FTweens = FBenchVectorTweens;
+        using FOutput = FVector;
+        static constexpr const char* Name = "vector";
+
+        static void Fill(FTweens& Tweens, int32 Index, std::mt19937& Random)
+        {
+            Tweens.Starts[Index] = RandomVector(Random);
+            Tweens.Ends[Index] = RandomVector(Random);
+        }
+
+        static void CopyRow(FTweens& Tweens, int32 Index, const FTweens& Source, int32 SourceIndex)
+        {
+            Tweens.Starts[Index] = Source.Starts[SourceIndex];
+            Tweens.Ends[Index] = Source.Ends[SourceIndex];
+        }
+
+        static void Evaluate(const FTweens& Tweens, const FLerpStepColumns& Step, const TArray<FVector>&, FOutput* Outputs, int32 Start, int32 Count)
+        {
+            LerpBatchKernels::LerpVectors(Tweens.Starts.GetData() + Start, Tweens.Ends.GetData() + Start, Step.Alphas.GetData() + Start, Outputs + Start, Count);
+        }
+    };
+
+    struct FQuatKind
+    {
+        using FTweens = FBenchQuatTweens;
+        using FOutput = FQuat;
+        static constexpr const char* Name = "quat";
+
+        static void Fill(FTweens& Tweens, int32 Index, std::mt19937& Random)
+        {
+            Tweens.Starts[Index] = RandomQuat(Random);
+            Tweens.Ends[Index] = RandomQuat(Random);
+        }
+
+        static void CopyRow(FTweens& Tweens, int32 Index, const FTweens& Source, int32 SourceIndex)
+        {
+            Tweens.Starts[Index] = Source.Starts[SourceIndex];
+            Tweens.Ends[Index] = Source.Ends[SourceIndex];
+        }
+
+        static void Evaluate(const FTweens& Tweens, const FLerpStepColumns& Step, const TArray<FVector>&, FOutput* Outputs, int32 Start, int32 Count)
+        {
+            LerpBatchKernels::SlerpQuats(Tweens.Starts.GetData() + Start, Tweens.Ends.GetData() + Start, Step.Alphas.GetData() + Start, Outputs + Start, Count, 0.0f);
+        }
+    };
+
+    struct FScalarKind
+    {
+        using FTweens = FBenchScalarTweens;
+        using FOutput = float;
+        static constexpr const char* Name = "float";
+
+        static void Fill(FTweens& Tweens, int32 Index, std::mt19937& Random)
+        {
+            std::uniform_real_distribution<float> Distribution(-1000.0f, 1000.0f);
+            Tweens.Starts[Index] = Distribution(Random);
+            Tweens.Ends[Index] = Distribution(Random);
+        }
+
+        static void CopyRow(FTweens& Tweens, int32 Index, const FTweens& Source, int32 SourceIndex)
+        {
+            Tweens.Starts[Index] = Source.Starts[SourceIndex];
+            Tweens.Ends[Index] = Source.Ends[SourceIndex];
+        }
+
+        static void Evaluate(const FTweens& Tweens, const FLerpStepColumns& Step, const TArray<FVector>&, FOutput* Outputs, int32 Start, int32 Count)
+        {
+            LerpBatchKernels::LerpFloats(Tweens.Starts.GetData() + Start, Tweens.Ends.GetData() + Start, Step.Alphas.GetData() + Start, Outputs + Start, Count);
+        }
+    };
+
+    struct FFollowKind
+    {
+        using FTweens = FBenchFollowTweens;
+        using FOutput = FVector;
+        static constexpr const char* Name = "follow";
+
+        static void Fill(FTweens& Tweens, int32 Index, std::mt19937& Random)
+        {
+            Tweens.SocketTargets[Index] = static_cast<int32>(Random() % NumSockets);
+            Tweens.Starts[Index] = RandomVector(Random);
+        }
+
+        static void CopyRow(FTweens& Tweens, int32 Index, const FTweens& Source, int32 SourceIndex)
+        {
+            Tweens.SocketTargets[Index] = Source.SocketTargets[SourceIndex];
+            Tweens.Starts[Index] = Source.Starts[SourceIndex];
+        }
+
+        // 与引擎相同，目标在写回时逐行取，不走批量内核
+        static void Evaluate(const FTweens& Tweens, const FLerpStepColumns& Step, const TArray<FVector>& SocketLocations, FOutput* Outputs, int32 Start, int32 Count)
+        {
+            for (int32 Index = Start; Index < Start + Count; ++Index)
+            {
+                Outputs[Index] = FMath::Lerp(Tweens.Starts[Index], SocketLocations[Tweens.SocketTargets[Index]], Step.Alphas[Index]);
+            }
+        }
+    };
+
+    struct FBenchConfig
+    {
+        int32 NumTweens = 0;
+        // INDEX_NONE为每行轮流使用全部缓动
+        int32 Ease = 0;
+        bool bMultiThreaded = false;
+        int32 NumFrames = 60;
+    };
+
+    struct FBenchResult
+    {
+        double StartNs = 0.0;
+        double UpdateNs = 0.0;
+        double RecycleNs = 0.0;
+        double Bytes = 0.0;
+    };
+
+    template <typename TweensType>
+    SIZE_T GetColumnsSize(TweensType& Tweens)
+    {
+        SIZE_T Size = 0;
+        Tweens.ForEachColumn([&Size](auto& Column)
+        {
+            Size += Column.GetAllocatedSize();
+        });
+        return Size;
+    }
+
+    SIZE_T GetStepSize(const FLerpStepColumns& Step)
+    {
+        return Step.Deltas.GetAllocatedSize() + Step.Alphas.GetAllocatedSize() + Step.Active.GetAllocatedSize()
+            + Step.Finished.GetAllocatedSize() + Step.Slots.GetAllocatedSize();
+    }
+
+    template <typename KindType>
+    FBenchResult RunBenchmark(const FBenchConfig& Config)
+    {
+        using FTweens = typename KindType::FTweens;
+        using FOutput = typename KindType::FOutput;
+
+        constexpr float DeltaTime = 1.0f / 60.0f;
+        const int32 Num = Config.NumTweens;
+        // 单线程时不分块；多线程时只要超过一块就并行
+        const int32 ParallelThreshold = Config.bMultiThreaded ? 1 : 0;
+        const int32 NumEases = static_cast<int32>(ELerpEase::Step) + 1;
+
+        std::mt19937 Random(12345);
+        FTweens Tweens;
+        FLerpSlotPool SlotPool;
+        FLerpStepColumns Step;
+        LerpEasing::FLerpSampleTables CurveTables;
+        TArray<TArray<int32>> EaseRows;
+        TArray<FOutput> Outputs;
+        TArray<FVector> SocketLocations;
+        SocketLocations.SetNum(NumSockets);
+
+        // 启动参数预先生成，计时只含存储本身
+        FTweens Source;
+        for (int32 Count = 0; Count < Num; ++Count)
+        {
+            const int32 Index = LerpTweenStorage::AddTween(Source, 0.0f, ELerpTweenFlags::None, FLerpTimeSource());
+            KindType::Fill(Source, Index, Random);
+        }
+
+        // 启动：从空存储逐个追加，含数组扩容，与游戏里陆续启动相同
+        FBenchResult Result;
+        const FClock::time_point StartBegin = FClock::now();
+        for (int32 Count = 0; Count < Num; ++Count)
+        {
+            // 时长长于测量的帧数，推进阶段没有tween结束
+            const float Duration = static_cast<float>(Config.NumFrames + 1) * DeltaTime * (2.0f + static_cast<float>(Count % 7));
+            const int32 Index = LerpTweenStorage::AddTween(Tweens, Duration, ELerpTweenFlags::None, FLerpTimeSource());
+            const FLerpHandle Handle = SlotPool.Allocate(ELerpTweenKind::Vector, Index);
+            Tweens.SlotIndices[Index] = Handle.Index;
+            Tweens.Eases[Index] = static_cast<ELerpEase>(Config.Ease == INDEX_NONE ? Count % NumEases : Config.Ease);
+            KindType::CopyRow(Tweens, Index, Source, Count);
+        }
+        Result.StartNs = SecondsSince(StartBegin) * 1e9 / Num;
+
+        Outputs.SetNumUninitialized(Num);
+        auto StepFrame = [&](float FrameDelta, uint32 FrameIndex)
+        {
+            for (int32 Socket = 0; Socket < NumSockets; ++Socket)
+            {
+                SocketLocations[Socket] = FVector(Socket * 100.0, FrameIndex * 10.0, 0.0);
+            }
+
+            LerpTweenStep::GatherStep(Tweens, Step, FrameDelta, FrameIndex, ParallelThreshold);
+            LerpTweenStep::AdvanceTweens(Tweens, Step, CurveTables, ParallelThreshold, EaseRows);
+            LerpTweenStep::ForEachStepChunk(Num, LerpTweenStep::GetNumStepChunks(Num, ParallelThreshold), [&](int32, int32 Start, int32 Count)
+            {
+                KindType::Evaluate(Tweens, Step, SocketLocations, Outputs.GetData(), Start, Count);
+            });
+        };
+
+        // 预热一帧，让临时列和工作线程就位
+        StepFrame(0.0f, 0);
+
+        const FClock::time_point UpdateBegin = FClock::now();
+        for (int32 Frame = 1; Frame <= Config.NumFrames; ++Frame)
+        {
+            StepFrame(DeltaTime, static_cast<uint32>(Frame));
+        }
+        Result.UpdateNs = SecondsSince(UpdateBegin) * 1e9 / (static_cast<double>(Num) * Config.NumFrames);
+        Result.Bytes = static_cast<double>(GetColumnsSize(Tweens) + SlotPool.GetAllocatedSize() + GetStepSize(Step) + Outputs.GetAllocatedSize()) / Num;
+
+        // 结束：一步走完全部tween，再按写回时的做法从后往前回收结束的行
+        StepFrame(1e6f, static_cast<uint32>(Config.NumFrames + 1));
+        const FClock::time_point RecycleBegin = FClock::now();
+        for (int32 Index = Step.Num() - 1; Index >= 0; --Index)
+        {
+            if (Step.Finished[Index])
+            {
+                SlotPool.Release(Tweens.SlotIndices[Index]);
+                LerpTweenStorage::RemoveTween(Tweens, Index);
+            }
+        }
+        Result.RecycleNs = SecondsSince(RecycleBegin) * 1e9 / Num;
+        check(Tweens.Num() == 0 && SlotPool.GetNumActive() == 0);
+
+        return Result;
+    }
+
+    const char* GetEaseName(int32 Ease)
+    {
+        switch (Ease)
+        {
+        case static_cast<int32>(ELerpEase::Linear): return "linear";
+        case static_cast<int32>(ELerpEase::QuadInOut): return "quad-in-out";
+        case static_cast<int32>(ELerpEase::ElasticOut): return "elastic-out";
+        case static_cast<int32>(ELerpEase::BounceOut): return "bounce-out";
+        default: return "mixed";
+        }
+    }
+
+    template <typename KindType>
+    void RunSweep(const TArray<int32>& Counts, int32 NumFrames, bool bCsv)
+    {
+        const int32 Eases[] = { static_cast<int32>(ELerpEase::Linear), static_cast<int32>(ELerpEase::QuadInOut), static_cast<int32>(ELerpEase::ElasticOut), static_cast<int32>(ELerpEase::BounceOut), INDEX_NONE };
+        for (const int32 Ease : Eases)
+        {
+            for (const int32 NumTweens : Counts)
+            {
+                for (const bool bMultiThreaded : { false, true })
+                {
+                    FBenchConfig Config;
+                    Config.NumTweens = NumTweens;
+                    Config.Ease = Ease;
+                    Config.bMultiThreaded = bMultiThreaded;
+                    Config.NumFrames = NumFrames;
+                    const FBenchResult Result = RunBenchmark<KindType>(Config);
+
+                    const char* Format = bCsv
+                        ? "%s,%s,%d,%s,%.2f,%.2f,%.2f,%.1f,%.3f\n"
+                        : "%-7s %-12s %7d  %-6s %10.2f %10.2f %10.2f %10.1f %10.3f\n";
+                    std::printf(Format, KindType::Name, GetEaseName(Ease), NumTweens, bMultiThreaded ? "multi" : "single",
+                        Result.StartNs, Result.UpdateNs, Result.RecycleNs, Result.Bytes, Result.UpdateNs * NumTweens * 1e-6);
+                }
+            }
+        }
+    }
+
+    bool ParseIntArg(const char* Arg, const char* Name, int32& OutValue)
+    {
+        const size_t Length = std::strlen(Name);
+        if (std::strncmp(Arg, Name, Length) != 0)
+        {
+            return false;
+        }
+        OutValue = std::atoi(Arg + Length);
+        return true;
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    int32 NumFrames = 60;
+    int32 MaxCount = 100000;
+    bool bCsv = false;
+    for (int32 ArgIndex = 1; ArgIndex < Argc; ++ArgIndex)
+    {
+        const char* Arg = Argv[ArgIndex];
+        if (std::strcmp(Arg, "--csv") == 0)
+        {
+            bCsv = true;
+        }
+        else if (!ParseIntArg(Arg, "--frames=", NumFrames) && !ParseIntArg(Arg, "--max-count=", MaxCount))
+        {
+            std::fprintf(stderr, "usage: %s [--frames=N] [--max-count=N] [--csv]\n", Argv[0]);
+            return 1;
+        }
+    }
+    NumFrames = FMath::Max(NumFrames, 1);
+
+    TArray<int32> Counts;
+    for (int32 Count = 100; Count <= MaxCount; Count *= 10)
+    {
+        Counts.Add(Count);
+    }
+
+    if (bCsv)
+    {
+        std::printf("kind,ease,tweens,threads,start_ns_per_tween,update_ns_per_tween_frame,recycle_ns_per_tween,bytes_per_tween,update_ms_per_frame\n");
+    }
+    else
+    {
+        std::printf("LerpCore benchmark: %d frames per run, %u hardware threads\n", NumFrames, std::thread::hardware_concurrency());
+        std::printf("%-7s %-12s %7s  %-6s %10s %10s %10s %10s %10s\n", "kind", "ease", "tweens", "thread", "start ns", "update ns", "recycle ns", "bytes", "ms/frame");
+    }
+
+    RunSweep<FVectorKind>(Counts, NumFrames, bCsv);
+    RunSweep<FQuatKind>(Counts, NumFrames, bCsv);
+    RunSweep<FScalarKind>(Counts, NumFrames, bCsv);
+    RunSweep<FFollowKind>(Counts, NumFrames, bCsv);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,184 @@
+#include "LerpCoreEasing.h"
+
+namespace LerpEasing
+{
+    namespace
+    {
+        constexpr int32 NumEases = static_cast<int32>(ELerpEase::VectorCurve) + 1;
+
+        template <ELerpEase Ease>
+        void EvaluateRows(float* Alphas, const int32* Rows, int32 NumRows)
+        {
+            for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+            {
+                float& Alpha = Alphas[Rows[RowIndex]];
+                Alpha = Evaluate<Ease>(Alpha);
+            }
+        }
+
+        void EvaluateCurveRows(const int32* CurveTableIndices, const FLerpSampleTables& CurveTables, float* Alphas, const int32* Rows, int32 NumRows)
+        {
+            for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+            {
+                const int32 Row = Rows[RowIndex];
+                Alphas[Row] = CurveTables.EvaluateFloat(CurveTableIndices[Row], Alphas[Row]);
+            }
+        }
+    }
+
+    int32 FLerpSampleTables::Add(int32 NumChannels)
+    {
+        int32 TableIndex;
+        if (FreeIndices.Num() > 0)
+        {
+            TableIndex = FreeIndices.Pop(EAllowShrinking::No);
+        }
+        else
+        {
+            TableIndex = Tables.AddDefaulted();
+        }
+
+        FTable& Table = Tables[TableIndex];
+        Table.RefCount = 1;
+        Table.Samples.SetNumUninitialized(NumSamples * NumChannels);
+        ++NumTables;
+        return TableIndex;
+    }
+
+    bool FLerpSampleTables::Release(int32 TableIndex)
+    {
+        FTable& Table = Tables[TableIndex];
+        if (--Table.RefCount > 0)
+        {
+            return false;
+        }
+
+        Table.Samples.Empty();
+        FreeIndices.Add(TableIndex);
+        --NumTables;
+        return true;
+    }
+
+    SIZE_T FLerpSampleTables::GetAllocatedSize() const
+    {
+        SIZE_T Size = Tables.GetAllocatedSize() + FreeIndices.GetAllocatedSize();
+        for (const FTable& Table : Tables)
+        {
+            Size += Table.Samples.GetAllocatedSize();
+        }
+        return Size;
+    }
+
+    void ApplyEases(const ELerpEase* Eases, const int32* CurveTableIndices, const FLerpSampleTables& CurveTables, float* Alphas, int32 Num, TArray<int32>& ScratchRows)
+    {
+        // 计数排序：先数每种缓动有几行
+        int32 Counts[NumEases] = {};
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            ++Counts[static_cast<int32>(Eases[Index])];
+        }
+
+        const int32 NumLinear = Counts[static_cast<int32>(ELerpEase::Linear)];
+        if (NumLinear == Num)
+        {
+            return;
+        }
+
+        // Linear不需要求值，不进桶
+        int32 Offsets[NumEases];
+        int32 NumRows = 0;
+        for (int32 EaseIndex = 0; EaseIndex < NumEases; ++EaseIndex)
+        {
+            Offsets[EaseIndex] = NumRows;
+            if (EaseIndex != static_cast<int32>(ELerpEase::Linear))
+            {
+                NumRows += Counts[EaseIndex];
+            }
+        }
+
+        ScratchRows.SetNumUninitialized(NumRows, EAllowShrinking::No);
+        int32 Cursors[NumEases];
+        FMemory::Memcpy(Cursors, Offsets, sizeof(Offsets));
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const int32 EaseIndex = static_cast<int32>(Eases[Index]);
+            if (EaseIndex != static_cast<int32>(ELerpEase::Linear))
+            {
+                ScratchRows[Cursors[EaseIndex]++] = Index;
+            }
+        }
+
+        for (int32 EaseIndex = 0; EaseIndex < NumEases; ++EaseIndex)
+        {
+            const int32 Count = Counts[EaseIndex];
+            if (Count == 0 || EaseIndex == static_cast<int32>(ELerpEase::Linear))
+            {
+                continue;
+            }
+
+            const int32* Rows = ScratchRows.GetData() + Offsets[EaseIndex];
+            switch (static_cast<ELerpEase>(EaseIndex))
+            {
+#define LERP_EASE_CASE(Ease) case ELerpEase::Ease: EvaluateRows<ELerpEase::Ease>(Alphas, Rows, Count); break;
+            LERP_EASE_CASE(QuadIn)
+            LERP_EASE_CASE(QuadOut)
+            LERP_EASE_CASE(QuadInOut)
+            LERP_EASE_CASE(CubicIn)
+            LERP_EASE_CASE(CubicOut)
+            LERP_EASE_CASE(CubicInOut)
+            LERP_EASE_CASE(ExpoIn)
+            LERP_EASE_CASE(ExpoOut)
+            LERP_EASE_CASE(ExpoInOut)
+            LERP_EASE_CASE(BackIn)
+            LERP_EASE_CASE(BackOut)
+            LERP_EASE_CASE(BackInOut)
+            LERP_EASE_CASE(ElasticIn)
+            LERP_EASE_CASE(ElasticOut)
+            LERP_EASE_CASE(ElasticInOut)
+            LERP_EASE_CASE(BounceIn)
+            LERP_EASE_CASE(BounceOut)
+            LERP_EASE_CASE(BounceInOut)
+            LERP_EASE_CASE(Step)
+#undef LERP_EASE_CASE
+            case ELerpEase::Curve:
+                EvaluateCurveRows(CurveTableIndices, CurveTables, Alphas, Rows, Count);
+                break;
+            default:
+                // VectorCurve保持线性进度，由向量tween在插值后逐轴查表
+                break;
+            }
+        }
+    }
+
+    float EvaluateEase(ELerpEase Ease, int32 CurveTableIndex, const FLerpSampleTables& CurveTables, float Alpha)
+    {
+        switch (Ease)
+        {
+#define LERP_EASE_CASE(Ease) case ELerpEase::Ease: return Evaluate<ELerpEase::Ease>(Alpha);
+        LERP_EASE_CASE(QuadIn)
+        LERP_EASE_CASE(QuadOut)
+        LERP_EASE_CASE(QuadInOut)
+        LERP_EASE_CASE(CubicIn)
+        LERP_EASE_CASE(CubicOut)
+        LERP_EASE_CASE(CubicInOut)
+        LERP_EASE_CASE(ExpoIn)
+        LERP_EASE_CASE(ExpoOut)
+        LERP_EASE_CASE(ExpoInOut)
+        LERP_EASE_CASE(BackIn)
+        LERP_EASE_CASE(BackOut)
+        LERP_EASE_CASE(BackInOut)
+        LERP_EASE_CASE(ElasticIn)
+        LERP_EASE_CASE(ElasticOut)
+        LERP_EASE_CASE(ElasticInOut)
+        LERP_EASE_CASE(BounceIn)
+        LERP_EASE_CASE(BounceOut)
+        LERP_EASE_CASE(BounceInOut)
+        LERP_EASE_CASE(Step)
+#undef LERP_EASE_CASE
+        case ELerpEase::Curve:
+            return CurveTables.EvaluateFloat(CurveTableIndex, Alpha);
+        default:
+            return Alpha;
+        }
+    }
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "LerpCoreTypes.h"
+
+namespace LerpEasing
+{
+    // 编译期按缓动种类展开，批量求值时每个种类一个专门的循环，不经函数指针
+    template <ELerpEase Ease>
+    FORCEINLINE float Evaluate(float T)
+    {
+        constexpr float BackC1 = 1.70158f;
+        constexpr float BackC2 = BackC1 * 1.525f;
+        constexpr float BackC3 = BackC1 + 1.0f;
+        constexpr float ElasticC4 = 2.0f * UE_PI / 3.0f;
+        constexpr float ElasticC5 = 2.0f * UE_PI / 4.5f;
+
+        if constexpr (Ease == ELerpEase::QuadIn)
+        {
+            return T * T;
+        }
+        else if constexpr (Ease == ELerpEase::QuadOut)
+        {
+            return 1.0f - (1.0f - T) * (1.0f - T);
+        }
+        else if constexpr (Ease == ELerpEase::QuadInOut)
+        {
+            return T < 0.5f ? 2.0f * T * T : 1.0f - FMath::Square(-2.0f * T + 2.0f) * 0.5f;
+        }
+        else if constexpr (Ease == ELerpEase::CubicIn)
+        {
+            return T * T * T;
+        }
+        else if constexpr (Ease == ELerpEase::CubicOut)
+        {
+            return 1.0f - FMath::Cube(1.0f - T);
+        }
+        else if constexpr (Ease == ELerpEase::CubicInOut)
+        {
+            return T < 0.5f ? 4.0f * T * T * T : 1.0f - FMath::Cube(-2.0f * T + 2.0f) * 0.5f;
+        }
+        else if constexpr (Ease == ELerpEase::ExpoIn)
+        {
+            return T <= 0.0f ? 0.0f : FMath::Pow(2.0f, 10.0f * T - 10.0f);
+        }
+        else if constexpr (Ease == ELerpEase::ExpoOut)
+        {
+            return T >= 1.0f ? 1.0f : 1.0f - FMath::Pow(2.0f, -10.0f * T);
+        }
+        else if constexpr (Ease == ELerpEase::ExpoInOut)
+        {
+            if (T <= 0.0f || T >= 1.0f)
+            {
+                return T <= 0.0f ? 0.0f : 1.0f;
+            }
+            return T < 0.5f ? FMath::Pow(2.0f, 20.0f * T - 10.0f) * 0.5f : (2.0f - FMath::Pow(2.0f, -20.0f * T + 10.0f)) * 0.5f;
+        }
+        else if constexpr (Ease == ELerpEase::BackIn)
+        {
+            return BackC3 * T * T * T - BackC1 * T * T;
+        }
+        else if constexpr (Ease == ELerpEase::BackOut)
+        {
+            return 1.0f + BackC3 * FMath::Cube(T - 1.0f) + BackC1 * FMath::Square(T - 1.0f);
+        }
+        else if constexpr (Ease == ELerpEase::BackInOut)
+        {
+            return T < 0.5f
+                ? FMath::Square(2.0f * T) * ((BackC2 + 1.0f) * 2.0f * T - BackC2) * 0.5f
+                : (FMath::Square(2.0f * T - 2.0f) * ((BackC2 + 1.0f) * (T * 2.0f - 2.0f) + BackC2) + 2.0f) * 0.5f;
+        }
+        else if constexpr (Ease == ELerpEase::ElasticIn)
+        {
+            if (T <= 0.0f || T >= 1.0f)
+            {
+                return T <= 0.0f ? 0.0f : 1.0f;
+            }
+            return -FMath::Pow(2.0f, 10.0f * T - 10.0f) * FMath::Sin((T * 10.0f - 10.75f) * ElasticC4);
+        }
+        else if constexpr (Ease == ELerpEase::ElasticOut)
+        {
+            if (T <= 0.0f || T >= 1.0f)
+            {
+                return T <= 0.0f ? 0.0f : 1.0f;
+            }
+            return FMath::Pow(2.0f, -10.0f * T) * FMath::Sin((T * 10.0f - 0.75f) * ElasticC4) + 1.0f;
+        }
+        else if constexpr (Ease == ELerpEase::ElasticInOut)
+        {
+            if (T <= 0.0f || T >= 1.0f)
+            {
+                return T <= 0.0f ? 0.0f : 1.0f;
+            }
+            return T < 0.5f
+                ? -(FMath::Pow(2.0f, 20.0f * T - 10.0f) * FMath::Sin((20.0f * T - 11.125f) * ElasticC5)) * 0.5f
+                : FMath::Pow(2.0f, -20.0f * T + 10.0f) * FMath::Sin((20.0f * T - 11.125f) * ElasticC5) * 0.5f + 1.0f;
+        }
+        else if constexpr (Ease == ELerpEase::BounceOut)
+        {
+            constexpr float N1 = 7.5625f;
+            constexpr float D1 = 2.75f;
+            if (T < 1.0f / D1)
+            {
+                return N1 * T * T;
+            }
+            if (T < 2.0f / D1)
+            {
+                T -= 1.5f / D1;
+                return N1 * T * T + 0.75f;
+            }
+            if (T < 2.5f / D1)
+            {
+                T -= 2.25f / D1;
+                return N1 * T * T + 0.9375f;
+            }
+            T -= 2.625f / D1;
+            return N1 * T * T + 0.984375f;
+        }
+        else if constexpr (Ease == ELerpEase::BounceIn)
+        {
+            return 1.0f - Evaluate<ELerpEase::BounceOut>(1.0f - T);
+        }
+        else if constexpr (Ease == ELerpEase::BounceInOut)
+        {
+            return T < 0.5f
+                ? (1.0f - Evaluate<ELerpEase::BounceOut>(1.0f - 2.0f * T)) * 0.5f
+                : (1.0f + Evaluate<ELerpEase::BounceOut>(2.0f * T - 1.0f)) * 0.5f;
+        }
+        else if constexpr (Ease == ELerpEase::Step)
+        {
+            return T < 1.0f ? 0.0f : 1.0f;
+        }
+        else
+        {
+            return T;
+        }
+    }
+
+    // 预先采样好的缓动表，按下标引用，引用计数归零时释放。
+    // 推进时只查表并线性过滤，不再做关键帧查找和三次插值；表的来源（曲线资产等）由调用方负责
+    class FLerpSampleTables
+    {
+    public:
+        static constexpr int32 NumSamples = 256;
+
+        // 新建一张每个采样点NumChannels个分量的表，引用计数为1。采样值由调用方写入GetSamples
+        int32 Add(int32 NumChannels);
+
+        float* GetSamples(int32 TableIndex) { return Tables[TableIndex].Samples.GetData(); }
+
+        void AddRef(int32 TableIndex) { ++Tables[TableIndex].RefCount; }
+
+        // 引用归零时释放这张表并返回true，下标随后可能被新表复用
+        bool Release(int32 TableIndex);
+
+        float EvaluateFloat(int32 TableIndex, float Alpha) const
+        {
+            const FTable& Table = Tables[TableIndex];
+            int32 Sample;
+            const float Fraction = GetSamplePosition(Alpha, Sample);
+            return FMath::Lerp(Table.Samples[Sample], Table.Samples[Sample + 1], Fraction);
+        }
+
+        FVector EvaluateVector(int32 TableIndex, float Alpha) const
+        {
+            const FTable& Table = Tables[TableIndex];
+            int32 Sample;
+            const float Fraction = GetSamplePosition(Alpha, Sample);
+            const float* Samples = Table.Samples.GetData() + Sample * 3;
+            return FVector(
+                FMath::Lerp(Samples[0], Samples[3], Fraction),
+                FMath::Lerp(Samples[1], Samples[4], Fraction),
+                FMath::Lerp(Samples[2], Samples[5], Fraction));
+        }
+
+        // 存活的表数
+        int32 Num() const { return NumTables; }
+
+        // 所有表占用的内存（字节）
+        SIZE_T GetAllocatedSize() const;
+
+    private:
+        struct FTable
+        {
+            int32 RefCount = 0;
+            // 逐采样点存放，向量表每点3个分量
+            TArray<float> Samples;
+        };
+
+        static float GetSamplePosition(float Alpha, int32& OutSample)
+        {
+            const float Position = FMath::Clamp(Alpha, 0.0f, 1.0f) * (NumSamples - 1);
+            OutSample = FMath::Min(FMath::FloorToInt32(Position), NumSamples - 2);
+            return Position - OutSample;
+        }
+
+        TArray<FTable> Tables;
+        // 已释放、可复用的下标
+        TArray<int32> FreeIndices;
+        int32 NumTables = 0;
+    };
+
+    // 对Alphas[0, Num)按各行的缓动求值。先按种类分桶，再对每个桶调用特化的循环；全为Linear时不做任何事
+    void ApplyEases(const ELerpEase* Eases, const int32* CurveTableIndices, const FLerpSampleTables& CurveTables, float* Alphas, int32 Num, TArray<int32>& ScratchRows);
+
+    // 单个值按运行期的缓动种类求值，用于无法整批处理的场合（如序列中的一段）
+    float EvaluateEase(ELerpEase Ease, int32 CurveTableIndex, const FLerpSampleTables& CurveTables, float Alpha);
+}
@@ -0,0 +1,116 @@
+#include "LerpCoreKernels.h"
+
+namespace LerpBatchKernels
+{
+    void AdvanceAlphas(float* Elapsed, const float* Deltas, const float* Durations, float* OutAlphas, int32 Num)
+    {
+        const VectorRegister4Float Zero = VectorZeroFloat();
+        const VectorRegister4Float One = VectorOneFloat();
+
+        int32 Index = 0;
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            const VectorRegister4Float NewElapsed = VectorAdd(VectorLoad(Elapsed + Index), VectorLoad(Deltas + Index));
+            VectorStore(NewElapsed, Elapsed + Index);
+
+            const VectorRegister4Float Alpha = VectorDivide(NewElapsed, VectorLoad(Durations + Index));
+            VectorStore(VectorMin(VectorMax(Alpha, Zero), One), OutAlphas + Index);
+        }
+
+        // 不足4个的尾部
+        for (; Index < Num; ++Index)
+        {
+            Elapsed[Index] += Deltas[Index];
+            OutAlphas[Index] = FMath::Clamp(Elapsed[Index] / Durations[Index], 0.0f, 1.0f);
+        }
+    }
+
+    void LerpFloats(const float* Starts, const float* Ends, const float* Alphas, float* Out, int32 Num)
+    {
+        int32 Index = 0;
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            const VectorRegister4Float Start = VectorLoad(Starts + Index);
+            const VectorRegister4Float Delta = VectorSubtract(VectorLoad(Ends + Index), Start);
+            // 先乘后加，不用VectorMultiplyAdd：FMA少一次舍入，会和FMath::Lerp差一位
+            VectorStore(VectorAdd(Start, VectorMultiply(VectorLoad(Alphas + Index), Delta)), Out + Index);
+        }
+
+        for (; Index < Num; ++Index)
+        {
+            Out[Index] = FMath::Lerp(Starts[Index], Ends[Index], Alphas[Index]);
+        }
+    }
+
+    void LerpVectors(const FVector* Starts, const FVector* Ends, const float* Alphas, FVector* Out, int32 Num)
+    {
+        // 每个FVector占一个4路double寄存器，第4路空置
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const VectorRegister4Double Start = VectorLoadFloat3(&Starts[Index].X);
+            const VectorRegister4Double Delta = VectorSubtract(VectorLoadFloat3(&Ends[Index].X), Start);
+            const VectorRegister4Double Alpha = VectorSetFloat1(static_cast<double>(Alphas[Index]));
+            VectorStoreFloat3(VectorAdd(Start, VectorMultiply(Alpha, Delta)), &Out[Index].X);
+        }
+    }
+
+    void SlerpQuats(const FQuat* Starts, const FQuat* Ends, const float* Alphas, FQuat* Out, int32 Num, float NlerpMaxAngle)
+    {
+        // 四元数点积是两旋转夹角一半的余弦
+        const double NlerpMinCos = FMath::Cos(FMath::DegreesToRadians(static_cast<double>(NlerpMaxAngle)) * 0.5);
+        // 与FQuat::Slerp相同：夹角过小时sin趋近0，只能线性插值
+        const double SlerpMaxCos = 0.9999;
+
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const VectorRegister4Double Start = VectorLoad(&Starts[Index].X);
+            VectorRegister4Double End = VectorLoad(&Ends[Index].X);
+
+            // q与-q是同一旋转，点积为负时换用-End走短的一侧
+            double Cos = VectorGetComponent(VectorDot4(Start, End), 0);
+            if (Cos < 0.0)
+            {
+                End = VectorNegate(End);
+                Cos = -Cos;
+            }
+
+            const double Alpha = static_cast<double>(Alphas[Index]);
+            double StartScale = 1.0 - Alpha;
+            double EndScale = Alpha;
+            if (Cos < SlerpMaxCos && Cos < NlerpMinCos)
+            {
+                const double Omega = FMath::Acos(Cos);
+                const double InvSin = 1.0 / FMath::Sin(Omega);
+                StartScale = FMath::Sin(StartScale * Omega) * InvSin;
+                EndScale = FMath::Sin(EndScale * Omega) * InvSin;
+            }
+
+            const VectorRegister4Double Result = VectorAdd(VectorMultiply(Start, VectorSetFloat1(StartScale)), VectorMultiply(End, VectorSetFloat1(EndScale)));
+            VectorStore(VectorNormalizeAccurate(Result), &Out[Index].X);
+        }
+    }
+
+    void SmoothDampVectors(FVector* Positions, FVector* Velocities, const FVector* Targets, const float* SmoothTimes, const float* Deltas, int32 Num)
+    {
+        // x(t) = (x0 + (v0 + w * x0) * t) * e^(-w * t)，x为相对目标的偏移，w = 2 / SmoothTime
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const double DeltaTime = Deltas[Index];
+            if (DeltaTime <= 0.0)
+            {
+                continue;
+            }
+
+            const double Omega = 2.0 / SmoothTimes[Index];
+            const double Decay = FMath::Exp(-Omega * DeltaTime);
+            const VectorRegister4Double Target = VectorLoadFloat3(&Targets[Index].X);
+            const VectorRegister4Double Velocity = VectorLoadFloat3(&Velocities[Index].X);
+            const VectorRegister4Double Offset = VectorSubtract(VectorLoadFloat3(&Positions[Index].X), Target);
+            const VectorRegister4Double Drift = VectorMultiply(VectorAdd(Velocity, VectorMultiply(VectorSetFloat1(Omega), Offset)), VectorSetFloat1(DeltaTime));
+
+            const VectorRegister4Double DecayRegister = VectorSetFloat1(Decay);
+            VectorStoreFloat3(VectorMultiply(VectorSubtract(Velocity, VectorMultiply(VectorSetFloat1(Omega), Drift)), DecayRegister), &Velocities[Index].X);
+            VectorStoreFloat3(VectorAdd(Target, VectorMultiply(VectorAdd(Offset, Drift), DecayRegister)), &Positions[Index].X);
+        }
+    }
+}
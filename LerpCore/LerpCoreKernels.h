@@ -0,0 +1,25 @@
+#pragma once
+
+#include "LerpCorePlatform.h"
+
+// 整批推进tween的SIMD内核，输入输出都是各列的连续数组。
+// 基于引擎的VectorRegister：x64上为SSE（引擎开启AVX时double向量走AVX），其余平台走NEON或标量实现；独立构建时为Standalone中的标量实现。
+// 运算顺序与FMath::Lerp完全一致且不使用FMA，结果与逐个调用FMath::Lerp逐位相同
+namespace LerpBatchKernels
+{
+    // Elapsed[i] += Deltas[i]，OutAlphas[i] = Clamp(Elapsed[i] / Durations[i], 0, 1)
+    void AdvanceAlphas(float* Elapsed, const float* Deltas, const float* Durations, float* OutAlphas, int32 Num);
+
+    // Out[i] = FMath::Lerp(Starts[i], Ends[i], Alphas[i])
+    void LerpFloats(const float* Starts, const float* Ends, const float* Alphas, float* Out, int32 Num);
+
+    void LerpVectors(const FVector* Starts, const FVector* Ends, const float* Alphas, FVector* Out, int32 Num);
+
+    // 最短路径的归一化Slerp，与FQuat::Slerp误差在浮点舍入以内（涉及三角函数，不保证逐位相同）。
+    // 两端夹角小于NlerpMaxAngle（度）时改用Nlerp，省掉acos和sin
+    void SlerpQuats(const FQuat* Starts, const FQuat* Ends, const float* Alphas, FQuat* Out, int32 Num, float NlerpMaxAngle);
+
+    // 临界阻尼弹簧按解析解推进Deltas[i]：目标在一步内不动时任意步长都稳定，
+    // 一步走完与分成几步走到同一时刻的结果相同（浮点舍入以内），轨迹与帧率无关
+    void SmoothDampVectors(FVector* Positions, FVector* Velocities, const FVector* Targets, const float* SmoothTimes, const float* Deltas, int32 Num);
+}
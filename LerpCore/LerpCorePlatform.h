@@ -0,0 +1,16 @@
+#pragma once
+
+// LerpCore只依赖引擎的基础类型（TArray、FVector、FQuat、FMath、VectorRegister、ParallelFor）。
+// 作为模块的一部分编译时直接使用引擎；定义LERP_CORE_STANDALONE=1时改用Standalone下的最小实现，
+// 不需要引擎即可单独构建（见LerpCore/CMakeLists.txt）
+
+#ifndef LERP_CORE_STANDALONE
+#define LERP_CORE_STANDALONE 0
+#endif
+
+#if LERP_CORE_STANDALONE
+#include "Standalone/LerpStandalone.h"
+#else
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#endif
@@ -0,0 +1,84 @@
+#include "LerpCoreStep.h"
+#include "LerpCoreKernels.h"
+
+namespace LerpTweenStep
+{
+    void GatherStepDeltas(FLerpTweenColumns& Tweens, const float* Dilations, float DeltaTime, uint32 StepIndex, int32 Start, int32 Count, float* OutDeltas, bool* OutActive)
+    {
+        for (int32 Index = Start; Index < Start + Count; ++Index)
+        {
+            if (IsWaiting(Tweens, Index))
+            {
+                OutDeltas[Index] = 0.0f;
+                OutActive[Index] = false;
+                continue;
+            }
+
+            const float Delta = DeltaTime * Dilations[Index] + Tweens.DeferredTimes[Index];
+            if (IsDelayed(Tweens, Index))
+            {
+                if (Tweens.Elapsed[Index] + Delta < 0.0f)
+                {
+                    Tweens.DeferredTimes[Index] = 0.0f;
+                    OutDeltas[Index] = Delta;
+                    OutActive[Index] = false;
+                    continue;
+                }
+                EnumRemoveFlags(Tweens.Flags[Index], ELerpTweenFlags::CaptureStart);
+            }
+
+            const uint32 Stride = Tweens.Strides[Index];
+            // 按槽位错开各行轮到的步；攒下的时间已够走完时不再等，按时结束并写入终点
+            const bool bSkip = Stride > 1
+                && (StepIndex + static_cast<uint32>(Tweens.SlotIndices[Index])) % Stride != 0
+                && Tweens.Elapsed[Index] + Delta < Tweens.Durations[Index];
+
+            Tweens.DeferredTimes[Index] = bSkip ? Delta : 0.0f;
+            OutDeltas[Index] = bSkip ? 0.0f : Delta;
+            OutActive[Index] = !bSkip;
+        }
+    }
+
+    void GatherStep(FLerpTweenColumns& Tweens, FLerpStepColumns& Step, float DeltaTime, uint32 StepIndex, int32 ParallelThreshold)
+    {
+        const int32 NumTweens = Tweens.Num();
+        Step.Slots = Tweens.SlotIndices;
+        Step.Dilations.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+        Step.Deltas.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+        Step.Active.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+
+        // 解析时间源（引擎里要读Actor）不能放到工作线程
+        for (int32 Index = 0; Index < NumTweens; ++Index)
+        {
+            Step.Dilations[Index] = GetTimeDilation(Tweens.TimeSources[Index]);
+        }
+
+        ForEachStepChunk(NumTweens, GetNumStepChunks(NumTweens, ParallelThreshold), [&Tweens, &Step, DeltaTime, StepIndex](int32, int32 Start, int32 Count)
+        {
+            GatherStepDeltas(Tweens, Step.Dilations.GetData(), DeltaTime, StepIndex, Start, Count, Step.Deltas.GetData(), Step.Active.GetData());
+        });
+    }
+
+    void AdvanceTweens(FLerpTweenColumns& Tweens, FLerpStepColumns& Step, const LerpEasing::FLerpSampleTables& CurveTables, int32 ParallelThreshold, TArray<TArray<int32>>& EaseRows)
+    {
+        const int32 NumTweens = Step.Num();
+        Step.Alphas.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+        Step.Finished.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+
+        const int32 NumChunks = GetNumStepChunks(NumTweens, ParallelThreshold);
+        if (EaseRows.Num() < NumChunks)
+        {
+            EaseRows.SetNum(NumChunks);
+        }
+
+        ForEachStepChunk(NumTweens, NumChunks, [&Tweens, &Step, &CurveTables, &EaseRows](int32 Chunk, int32 Start, int32 Count)
+        {
+            LerpBatchKernels::AdvanceAlphas(Tweens.Elapsed.GetData() + Start, Step.Deltas.GetData() + Start, Tweens.Durations.GetData() + Start, Step.Alphas.GetData() + Start, Count);
+            for (int32 Index = Start; Index < Start + Count; ++Index)
+            {
+                Step.Finished[Index] = IsTweenFinished(Tweens, Index);
+            }
+            LerpEasing::ApplyEases(Tweens.Eases.GetData() + Start, Tweens.CurveTableIndices.GetData() + Start, CurveTables, Step.Alphas.GetData() + Start, Count, EaseRows[Chunk]);
+        });
+    }
+}
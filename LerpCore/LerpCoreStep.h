@@ -0,0 +1,90 @@
+#pragma once
+
+#include "LerpCoreStorage.h"
+#include "LerpCoreEasing.h"
+
+// 一种tween本步的中间结果，按整理时的行号存放
+struct FLerpStepColumns
+{
+    // 各行时间源的倍率。时间源在引擎里是Actor的弱引用，整理时先在调用线程上逐行取好，分块计算只读这一列
+    TArray<float> Dilations;
+    TArray<float> Deltas;
+    TArray<float> Alphas;
+    // 本步是否推进并写回，暂停、排队中和降频跳过的行为false
+    TArray<bool> Active;
+    // 按求值时的进度判断是否结束，写回前FinishTween改了Elapsed也要先写回本步的值
+    TArray<bool> Finished;
+    // 整理时每行的槽位
+    TArray<int32> Slots;
+
+    int32 Num() const { return Slots.Num(); }
+};
+
+// 与目标无关的推进步骤：整理时间增量、推进进度、求缓动。读目标和写回由调用方（ULerpSubsystem）负责
+namespace LerpTweenStep
+{
+    inline bool IsWaiting(const FLerpTweenColumns& Tweens, int32 Index)
+    {
+        return EnumHasAnyFlags(Tweens.Flags[Index], ELerpTweenFlags::Paused | ELerpTweenFlags::Queued);
+    }
+
+    // 带启动延迟的行以负的Elapsed开始，延迟期间只计时，不写回也不读取缓动
+    inline bool IsDelayed(const FLerpTweenColumns& Tweens, int32 Index)
+    {
+        return Tweens.Elapsed[Index] < 0.0f;
+    }
+
+    // 缓动后的Alpha可能越过1又回来（Back、Elastic），是否结束只看时间
+    inline bool IsTweenFinished(const FLerpTweenColumns& Tweens, int32 Index)
+    {
+        return Tweens.Elapsed[Index] >= Tweens.Durations[Index];
+    }
+
+    // 整理到写回之间，回调或外部调用可能取消或启动lerp使行被挪动。
+    // 整理时记下的槽位对不上时该行留到下一步处理，新追加的行也等到下一步
+    inline bool IsStepRowUnchanged(const FLerpTweenColumns& Tweens, const FLerpStepColumns& Step, int32 Index)
+    {
+        return Index < Step.Num() && Tweens.SlotIndices.IsValidIndex(Index) && Tweens.SlotIndices[Index] == Step.Slots[Index];
+    }
+
+    // 并行时每块的行数。取4的倍数，SIMD内核按4个一组处理的划分与单线程时完全相同
+    constexpr int32 StepChunkSize = 1024;
+
+    // Threshold为0时不分块
+    inline int32 GetNumStepChunks(int32 NumTweens, int32 Threshold)
+    {
+        return Threshold > 0 && NumTweens >= Threshold ? FMath::DivideAndRoundUp(NumTweens, StepChunkSize) : 1;
+    }
+
+    // Func(Chunk, Start, Count)。只有一块时直接在当前线程执行。
+    // 块内只读tween状态、写本块的临时列，不碰UObject的写入，调用方在ParallelFor返回前一直等待
+    template <typename FuncType>
+    void ForEachStepChunk(int32 NumTweens, int32 NumChunks, const FuncType& Func)
+    {
+        if (NumChunks <= 1)
+        {
+            Func(0, 0, NumTweens);
+            return;
+        }
+
+        ParallelFor(NumChunks, [&Func, NumTweens](int32 Chunk)
+        {
+            const int32 Start = Chunk * StepChunkSize;
+            Func(Chunk, Start, FMath::Min(StepChunkSize, NumTweens - Start));
+        });
+    }
+
+    // 批量推进前整理出[Start, Start + Count)每行本步的时间增量和是否推进。
+    // 暂停、排队中以及降频跳过的行增量为0，跳过的行把时间攒到轮到的那一步。
+    // 延迟中的行照常计时但不推进，延迟结束的那一步清掉CaptureStart，起点就是整理时最后读回的值
+    // Dilations为各行时间源的倍率，只读数值列，可在工作线程上执行
+    void GatherStepDeltas(FLerpTweenColumns& Tweens, const float* Dilations, float DeltaTime, uint32 StepIndex, int32 Start, int32 Count, float* OutDeltas, bool* OutActive);
+
+    // 记下本步的槽位和每行的时间增量。DeltaTime已含全局时间膨胀，各行再乘上自己时间源的倍率。
+    // 倍率在调用线程上逐行解析到Step.Dilations，之后才分块
+    void GatherStep(FLerpTweenColumns& Tweens, FLerpStepColumns& Step, float DeltaTime, uint32 StepIndex, int32 ParallelThreshold);
+
+    // 整批推进一种tween：Step.Alphas得到缓动后的Alpha，Step.Finished按推进后的进度给出。
+    // 行数达到ParallelThreshold时分块在工作线程上计算，EaseRows为每块一份的缓动分桶临时行号
+    void AdvanceTweens(FLerpTweenColumns& Tweens, FLerpStepColumns& Step, const LerpEasing::FLerpSampleTables& CurveTables, int32 ParallelThreshold, TArray<TArray<int32>>& EaseRows);
+}
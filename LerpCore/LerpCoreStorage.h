@@ -0,0 +1,228 @@
+#pragma once
+
+#include "LerpCoreTypes.h"
+
+// tween存放在哪一种数组里
+enum class ELerpTweenKind : uint8
+{
+    None,
+    Vector,
+    Quat,
+    Scalar,
+    Follow,
+    Sequence,
+    Spring,
+};
+
+enum class ELerpTweenFlags : uint8
+{
+    None = 0,
+    // 每步先读回目标的当前值作为起点（MoveComponentRelativeToParent等原有写法）
+    FromCurrent = 1 << 0,
+    // 暂停中，不推进也不写回
+    Paused = 1 << 1,
+    // 排在同通道的另一个tween之后，轮到它之前不推进
+    Queued = 1 << 2,
+    // 下一次推进前先读回目标当前值作为起点（排队轮到时、被改写目标时）
+    CaptureStart = 1 << 3,
+};
+ENUM_CLASS_FLAGS(ELerpTweenFlags);
+
+// 同一目标上互相冲突的属性。同一(目标, 通道)同时只允许一个tween在推进
+enum class ELerpChannel : uint8
+{
+    Location,
+    Rotation,
+    Scale,
+    FieldOfView,
+    Float,
+    // 按名字区分的参数（材质参数、Setter函数），名字放在SubKey里
+    Parameter,
+};
+
+struct FLerpChannelKey
+{
+    // 组件、相机或float地址，只用作身份比较
+    const void* Target = nullptr;
+    ELerpChannel Channel = ELerpChannel::Location;
+    // 同一目标同一通道下再按名字细分，同样只用作身份比较
+    uint64 SubKey = 0;
+
+    FLerpChannelKey() = default;
+    FLerpChannelKey(const void* InTarget, ELerpChannel InChannel, uint64 InSubKey = 0)
+        : Target(InTarget)
+        , Channel(InChannel)
+        , SubKey(InSubKey)
+    {
+    }
+
+    bool operator==(const FLerpChannelKey& Other) const { return Target == Other.Target && Channel == Other.Channel && SubKey == Other.SubKey; }
+
+    friend uint32 GetTypeHash(const FLerpChannelKey& Key)
+    {
+        return HashCombine(HashCombine(::PointerHash(Key.Target), ::GetTypeHash(Key.Channel)), ::GetTypeHash(Key.SubKey));
+    }
+};
+
+// 所有tween共有的列。每种tween按列存放在连续数组里，只带自己需要的字段
+struct FLerpTweenColumns
+{
+    // 该行对应的槽位，删除行时用来修正被挪动行的槽位
+    TArray<int32> SlotIndices;
+    TArray<float> Elapsed;
+    TArray<float> Durations;
+    TArray<ELerpTweenFlags> Flags;
+    // 提供时间膨胀的时间源，没有则只受全局时间膨胀影响
+    TArray<FLerpTimeSource> TimeSources;
+    TArray<ELerpEase> Eases;
+    // Ease为Curve时指向预先采样好的曲线表
+    TArray<int32> CurveTableIndices;
+    // 每几步推进一次，由目标的重要度决定，1为每步都推进
+    TArray<uint8> Strides;
+    // 降频时跳过的步攒下的时间，轮到时一次补上
+    TArray<float> DeferredTimes;
+
+    int32 Num() const { return Durations.Num(); }
+};
+
+// 槽位池：句柄指向槽位，槽位再指向各种类数组中的行。行会因删除而移动，槽位不会
+struct FLerpSlot
+{
+    int32 DenseIndex = INDEX_NONE;
+    int32 NextFree = INDEX_NONE;
+    uint32 Generation = 1;
+    ELerpTweenKind Kind = ELerpTweenKind::None;
+
+    // 该tween占用的通道，以及排在它后面的同通道tween
+    FLerpChannelKey ChannelKey;
+    int32 NextQueued = INDEX_NONE;
+};
+
+class FLerpSlotPool
+{
+public:
+    // 优先从空闲链表复用槽位，池子只在历史峰值之上才增长
+    FLerpHandle Allocate(ELerpTweenKind Kind, int32 DenseIndex)
+    {
+        int32 SlotIndex = FirstFree;
+        if (SlotIndex != INDEX_NONE)
+        {
+            FirstFree = Slots[SlotIndex].NextFree;
+        }
+        else
+        {
+            SlotIndex = Slots.AddDefaulted();
+        }
+
+        FLerpSlot& Slot = Slots[SlotIndex];
+        Slot.Kind = Kind;
+        Slot.DenseIndex = DenseIndex;
+        Slot.NextFree = INDEX_NONE;
+        ++NumActive;
+
+        FLerpHandle Handle;
+        Handle.Index = SlotIndex;
+        Handle.Generation = Slot.Generation;
+        return Handle;
+    }
+
+    // 回收槽位并递增代数，指向它的旧句柄随之失效
+    void Release(int32 SlotIndex)
+    {
+        FLerpSlot& Slot = Slots[SlotIndex];
+        check(Slot.Kind != ELerpTweenKind::None);
+
+        Slot.Kind = ELerpTweenKind::None;
+        Slot.DenseIndex = INDEX_NONE;
+        Slot.ChannelKey = FLerpChannelKey();
+        Slot.NextQueued = INDEX_NONE;
+        Slot.NextFree = FirstFree;
+        // 代数为0保留给默认构造的空句柄
+        Slot.Generation = Slot.Generation == MAX_uint32 ? 1 : Slot.Generation + 1;
+        FirstFree = SlotIndex;
+        --NumActive;
+    }
+
+    // 句柄仍指向存活的tween时返回其槽位，否则返回nullptr
+    const FLerpSlot* Find(const FLerpHandle& Handle) const
+    {
+        if (!Slots.IsValidIndex(Handle.Index))
+        {
+            return nullptr;
+        }
+
+        const FLerpSlot& Slot = Slots[Handle.Index];
+        return Slot.Generation == Handle.Generation && Slot.Kind != ELerpTweenKind::None ? &Slot : nullptr;
+    }
+
+    FLerpSlot* Find(const FLerpHandle& Handle)
+    {
+        return const_cast<FLerpSlot*>(static_cast<const FLerpSlotPool*>(this)->Find(Handle));
+    }
+
+    FLerpHandle MakeHandle(int32 SlotIndex) const
+    {
+        FLerpHandle Handle;
+        Handle.Index = SlotIndex;
+        Handle.Generation = Slots[SlotIndex].Generation;
+        return Handle;
+    }
+
+    FLerpSlot& operator[](int32 SlotIndex) { return Slots[SlotIndex]; }
+    const FLerpSlot& operator[](int32 SlotIndex) const { return Slots[SlotIndex]; }
+
+    int32 GetNumActive() const { return NumActive; }
+    int32 GetCapacity() const { return Slots.Num(); }
+
+    void Reserve(int32 Number) { Slots.Reserve(Number); }
+
+    SIZE_T GetAllocatedSize() const { return Slots.GetAllocatedSize(); }
+
+private:
+    TArray<FLerpSlot> Slots;
+    int32 FirstFree = INDEX_NONE;
+    int32 NumActive = 0;
+};
+
+namespace LerpTweenStorage
+{
+    // 在末尾追加一行，返回下标。调用方随后逐列填值
+    template <typename TweensType>
+    int32 AddTween(TweensType& Tweens, float Duration, ELerpTweenFlags Flags, const FLerpTimeSource& TimeSource)
+    {
+        const int32 Index = Tweens.Num();
+        Tweens.ForEachColumn([](auto& Column)
+        {
+            Column.AddDefaulted();
+        });
+        Tweens.Elapsed[Index] = 0.0f;
+        Tweens.Durations[Index] = Duration;
+        Tweens.Flags[Index] = Flags;
+        Tweens.TimeSources[Index] = TimeSource;
+        Tweens.Eases[Index] = ELerpEase::Linear;
+        Tweens.CurveTableIndices[Index] = INDEX_NONE;
+        Tweens.Strides[Index] = 1;
+        Tweens.DeferredTimes[Index] = 0.0f;
+        return Index;
+    }
+
+    // 批量追加前一次为全部列预留到Number行
+    template <typename TweensType>
+    void Reserve(TweensType& Tweens, int32 Number)
+    {
+        Tweens.ForEachColumn([Number](auto& Column)
+        {
+            Column.Reserve(Number);
+        });
+    }
+
+    // 用最后一行填补被删除的行，不收缩内存
+    template <typename TweensType>
+    void RemoveTween(TweensType& Tweens, int32 Index)
+    {
+        Tweens.ForEachColumn([Index](auto& Column)
+        {
+            Column.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        });
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "LerpCorePlatform.h"
+
+#if LERP_CORE_STANDALONE
+
+// 与LerpTypes.h中的蓝图类型保持一致，独立构建时没有UHT，在这里给出等价的普通定义
+
+enum class ELerpEase : uint8
+{
+    Linear,
+    QuadIn,
+    QuadOut,
+    QuadInOut,
+    CubicIn,
+    CubicOut,
+    CubicInOut,
+    ExpoIn,
+    ExpoOut,
+    ExpoInOut,
+    BackIn,
+    BackOut,
+    BackInOut,
+    ElasticIn,
+    ElasticOut,
+    ElasticInOut,
+    BounceIn,
+    BounceOut,
+    BounceInOut,
+    Step,
+    Curve,
+    VectorCurve,
+};
+
+struct FLerpHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    void Invalidate() { *this = FLerpHandle(); }
+
+    bool operator==(const FLerpHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    bool operator!=(const FLerpHandle& Other) const { return !(*this == Other); }
+};
+
+// 独立构建没有Actor，时间源直接给出时间膨胀倍率
+struct FLerpTimeSource
+{
+    float Dilation = 1.0f;
+};
+
+inline float GetTimeDilation(const FLerpTimeSource& TimeSource)
+{
+    return TimeSource.Dilation;
+}
+
+#else
+
+#include "../LerpTypes.h"
+
+class AActor;
+
+// 提供CustomTimeDilation的Actor
+using FLerpTimeSource = TWeakObjectPtr<AActor>;
+
+// 时间源的CustomTimeDilation，时间源为空或已销毁时为1。定义在LerpSubsystem.cpp
+float GetTimeDilation(const FLerpTimeSource& TimeSource);
+
+#endif
@@ -0,0 +1,136 @@
+#include "../LerpCorePlatform.h"
+
+// 引擎内编译时由引擎提供ParallelFor，这里整个文件为空
+#if LERP_CORE_STANDALONE
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // 常驻的工作线程，避免每次ParallelFor都创建线程。同一时刻只执行一批任务
+    class FLerpWorkerPool
+    {
+    public:
+        static FLerpWorkerPool& Get()
+        {
+            static FLerpWorkerPool Pool;
+            return Pool;
+        }
+
+        int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+        void Run(int32 Num, const std::function<void(int32)>& Body)
+        {
+            std::lock_guard<std::mutex> RunLock(RunMutex);
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                JobBody = &Body;
+                JobNum = Num;
+                NextIndex.store(0);
+                ++JobSerial;
+            }
+            Wake.notify_all();
+
+            // 当前线程也参与执行
+            Work(Body, Num);
+
+            // 已领到这批任务的线程全部退出后才返回，Body在此之前一直有效
+            std::unique_lock<std::mutex> Lock(Mutex);
+            Idle.wait(Lock, [this] { return BusyWorkers == 0; });
+            JobBody = nullptr;
+        }
+
+    private:
+        FLerpWorkerPool()
+        {
+            const int32 NumWorkers = FMath::Max(static_cast<int32>(std::thread::hardware_concurrency()) - 1, 0);
+            for (int32 Index = 0; Index < NumWorkers; ++Index)
+            {
+                Workers.emplace_back([this] { WorkerMain(); });
+            }
+        }
+
+        ~FLerpWorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                bStopping = true;
+            }
+            Wake.notify_all();
+            for (std::thread& Worker : Workers)
+            {
+                Worker.join();
+            }
+        }
+
+        void Work(const std::function<void(int32)>& Body, int32 Num)
+        {
+            for (int32 Index = NextIndex.fetch_add(1); Index < Num; Index = NextIndex.fetch_add(1))
+            {
+                Body(Index);
+            }
+        }
+
+        void WorkerMain()
+        {
+            uint64 SeenSerial = 0;
+            std::unique_lock<std::mutex> Lock(Mutex);
+            for (;;)
+            {
+                Wake.wait(Lock, [this, SeenSerial] { return bStopping || (JobBody && JobSerial != SeenSerial); });
+                if (bStopping)
+                {
+                    return;
+                }
+
+                // 领取任务与计数在同一把锁下，Run不会在领取后、执行完之前返回
+                SeenSerial = JobSerial;
+                const std::function<void(int32)>* Body = JobBody;
+                const int32 Num = JobNum;
+                ++BusyWorkers;
+                Lock.unlock();
+
+                Work(*Body, Num);
+
+                Lock.lock();
+                if (--BusyWorkers == 0)
+                {
+                    Idle.notify_all();
+                }
+            }
+        }
+
+        std::vector<std::thread> Workers;
+        std::mutex RunMutex;
+        std::mutex Mutex;
+        std::condition_variable Wake;
+        std::condition_variable Idle;
+
+        const std::function<void(int32)>* JobBody = nullptr;
+        int32 JobNum = 0;
+        uint64 JobSerial = 0;
+        std::atomic<int32> NextIndex{ 0 };
+        int32 BusyWorkers = 0;
+        bool bStopping = false;
+    };
+}
+
+void ParallelFor(int32 Num, const std::function<void(int32)>& Body, bool bForceSingleThread)
+{
+    if (bForceSingleThread || Num <= 1 || FLerpWorkerPool::Get().GetNumWorkers() == 0)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Body(Index);
+        }
+        return;
+    }
+
+    FLerpWorkerPool::Get().Run(Num, Body);
+}
+
+#endif
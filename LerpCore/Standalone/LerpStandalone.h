@@ -0,0 +1,584 @@
+#pragma once
+
+// 独立构建（LERP_CORE_STANDALONE）时代替CoreMinimal：只实现LerpCore用到的那一小部分引擎类型和函数，
+// 名字和语义与引擎一致，LerpCore的代码在两边不用改动。不追求与引擎逐位相同的数学结果
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+typedef std::int8_t int8;
+typedef std::int16_t int16;
+typedef std::int32_t int32;
+typedef std::int64_t int64;
+typedef std::uint8_t uint8;
+typedef std::uint16_t uint16;
+typedef std::uint32_t uint32;
+typedef std::uint64_t uint64;
+typedef std::size_t SIZE_T;
+
+#define FORCEINLINE inline __attribute__((always_inline))
+#define check(Expr) assert(Expr)
+#define checkSlow(Expr) assert(Expr)
+
+#define INDEX_NONE (-1)
+#define MAX_uint8 ((uint8)0xff)
+#define MAX_uint32 ((uint32)0xffffffff)
+#define MAX_int32 ((int32)0x7fffffff)
+#define UE_PI (3.1415926535897932f)
+#define PI UE_PI
+#define UE_KINDA_SMALL_NUMBER (1.e-4f)
+#define KINDA_SMALL_NUMBER UE_KINDA_SMALL_NUMBER
+
+template <typename T>
+FORCEINLINE std::remove_reference_t<T>&& MoveTemp(T&& Value)
+{
+    return static_cast<std::remove_reference_t<T>&&>(Value);
+}
+
+template <typename T>
+struct TNumericLimits
+{
+    static constexpr T Min() { return std::numeric_limits<T>::min(); }
+    static constexpr T Max() { return std::numeric_limits<T>::max(); }
+    static constexpr T Lowest() { return std::numeric_limits<T>::lowest(); }
+};
+
+#define ENUM_CLASS_FLAGS(Enum) \
+    inline constexpr Enum& operator|=(Enum& Lhs, Enum Rhs) { return Lhs = (Enum)((std::underlying_type_t<Enum>)Lhs | (std::underlying_type_t<Enum>)Rhs); } \
+    inline constexpr Enum& operator&=(Enum& Lhs, Enum Rhs) { return Lhs = (Enum)((std::underlying_type_t<Enum>)Lhs & (std::underlying_type_t<Enum>)Rhs); } \
+    inline constexpr Enum operator|(Enum Lhs, Enum Rhs) { return (Enum)((std::underlying_type_t<Enum>)Lhs | (std::underlying_type_t<Enum>)Rhs); } \
+    inline constexpr Enum operator&(Enum Lhs, Enum Rhs) { return (Enum)((std::underlying_type_t<Enum>)Lhs & (std::underlying_type_t<Enum>)Rhs); } \
+    inline constexpr Enum operator~(Enum E) { return (Enum)~(std::underlying_type_t<Enum>)E; } \
+    inline constexpr bool operator!(Enum E) { return !(std::underlying_type_t<Enum>)E; }
+
+template <typename Enum>
+constexpr bool EnumHasAnyFlags(Enum Flags, Enum Contains)
+{
+    return ((std::underlying_type_t<Enum>)Flags & (std::underlying_type_t<Enum>)Contains) != 0;
+}
+
+template <typename Enum>
+constexpr bool EnumHasAllFlags(Enum Flags, Enum Contains)
+{
+    return ((std::underlying_type_t<Enum>)Flags & (std::underlying_type_t<Enum>)Contains) == (std::underlying_type_t<Enum>)Contains;
+}
+
+template <typename Enum>
+void EnumAddFlags(Enum& Flags, Enum FlagsToAdd)
+{
+    Flags |= FlagsToAdd;
+}
+
+template <typename Enum>
+void EnumRemoveFlags(Enum& Flags, Enum FlagsToRemove)
+{
+    Flags &= ~FlagsToRemove;
+}
+
+inline uint32 HashCombine(uint32 A, uint32 C)
+{
+    return A ^ (C + 0x9e3779b9u + (A << 6) + (A >> 2));
+}
+
+inline uint32 PointerHash(const void* Key)
+{
+    const uint64 Value = reinterpret_cast<uint64>(Key) >> 4;
+    return static_cast<uint32>(Value ^ (Value >> 32));
+}
+
+template <typename T>
+std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>, uint32> GetTypeHash(T Value)
+{
+    return static_cast<uint32>(Value);
+}
+
+struct FMemory
+{
+    static void* Memcpy(void* Dest, const void* Src, SIZE_T Count) { return std::memcpy(Dest, Src, Count); }
+    static void* Memmove(void* Dest, const void* Src, SIZE_T Count) { return std::memmove(Dest, Src, Count); }
+    static void* Memset(void* Dest, uint8 Char, SIZE_T Count) { return std::memset(Dest, Char, Count); }
+    static void* Memzero(void* Dest, SIZE_T Count) { return std::memset(Dest, 0, Count); }
+};
+
+struct FMath
+{
+    template <typename T> static constexpr T Min(T A, T B) { return A < B ? A : B; }
+    template <typename T> static constexpr T Max(T A, T B) { return A > B ? A : B; }
+    template <typename T> static constexpr T Clamp(T X, T MinValue, T MaxValue) { return X < MinValue ? MinValue : X < MaxValue ? X : MaxValue; }
+    template <typename T> static constexpr T Abs(T A) { return A < T(0) ? -A : A; }
+    template <typename T> static constexpr T Square(T A) { return A * A; }
+    template <typename T> static constexpr T Cube(T A) { return A * A * A; }
+
+    // 与引擎相同：A + Alpha * (B - A)
+    template <typename T, typename U>
+    static constexpr T Lerp(const T& A, const T& B, const U& Alpha)
+    {
+        return static_cast<T>(A + Alpha * (B - A));
+    }
+
+    static float Pow(float A, float B) { return std::pow(A, B); }
+    static double Pow(double A, double B) { return std::pow(A, B); }
+    static float Sin(float Value) { return std::sin(Value); }
+    static double Sin(double Value) { return std::sin(Value); }
+    static float Cos(float Value) { return std::cos(Value); }
+    static double Cos(double Value) { return std::cos(Value); }
+    static float Acos(float Value) { return std::acos(std::clamp(Value, -1.0f, 1.0f)); }
+    static double Acos(double Value) { return std::acos(std::clamp(Value, -1.0, 1.0)); }
+    static float Exp(float Value) { return std::exp(Value); }
+    static double Exp(double Value) { return std::exp(Value); }
+    static float Sqrt(float Value) { return std::sqrt(Value); }
+    static double Sqrt(double Value) { return std::sqrt(Value); }
+    static int32 FloorToInt32(float Value) { return static_cast<int32>(std::floor(Value)); }
+    static int32 FloorToInt32(double Value) { return static_cast<int32>(std::floor(Value)); }
+
+    template <typename T> static constexpr T DivideAndRoundUp(T Dividend, T Divisor) { return (Dividend + Divisor - 1) / Divisor; }
+    template <typename T> static constexpr T DegreesToRadians(T Degrees) { return Degrees * (T(UE_PI) / T(180)); }
+    template <typename T> static constexpr T RadiansToDegrees(T Radians) { return Radians * (T(180) / T(UE_PI)); }
+
+    static bool IsNearlyZero(double Value, double Tolerance = UE_KINDA_SMALL_NUMBER) { return std::abs(Value) <= Tolerance; }
+};
+
+struct FVector
+{
+    double X = 0.0;
+    double Y = 0.0;
+    double Z = 0.0;
+
+    static const FVector ZeroVector;
+    static const FVector OneVector;
+
+    FVector() = default;
+    constexpr explicit FVector(double InF) : X(InF), Y(InF), Z(InF) {}
+    constexpr FVector(double InX, double InY, double InZ) : X(InX), Y(InY), Z(InZ) {}
+
+    FVector operator+(const FVector& V) const { return FVector(X + V.X, Y + V.Y, Z + V.Z); }
+    FVector operator-(const FVector& V) const { return FVector(X - V.X, Y - V.Y, Z - V.Z); }
+    FVector operator*(const FVector& V) const { return FVector(X * V.X, Y * V.Y, Z * V.Z); }
+    FVector operator*(double Scale) const { return FVector(X * Scale, Y * Scale, Z * Scale); }
+    FVector operator/(double Scale) const { return FVector(X / Scale, Y / Scale, Z / Scale); }
+    FVector operator-() const { return FVector(-X, -Y, -Z); }
+    FVector& operator+=(const FVector& V) { X += V.X; Y += V.Y; Z += V.Z; return *this; }
+    FVector& operator-=(const FVector& V) { X -= V.X; Y -= V.Y; Z -= V.Z; return *this; }
+    bool operator==(const FVector& V) const { return X == V.X && Y == V.Y && Z == V.Z; }
+    bool operator!=(const FVector& V) const { return !(*this == V); }
+
+    double SizeSquared() const { return X * X + Y * Y + Z * Z; }
+    double Size() const { return std::sqrt(SizeSquared()); }
+    static double DistSquared(const FVector& A, const FVector& B) { return (B - A).SizeSquared(); }
+    static double Dist(const FVector& A, const FVector& B) { return (B - A).Size(); }
+};
+
+inline FVector operator*(double Scale, const FVector& V)
+{
+    return V * Scale;
+}
+
+inline const FVector FVector::ZeroVector(0.0, 0.0, 0.0);
+inline const FVector FVector::OneVector(1.0, 1.0, 1.0);
+
+struct FQuat
+{
+    double X = 0.0;
+    double Y = 0.0;
+    double Z = 0.0;
+    double W = 1.0;
+
+    static const FQuat Identity;
+
+    FQuat() = default;
+    constexpr FQuat(double InX, double InY, double InZ, double InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
+
+    // 绕单位轴旋转Angle弧度
+    FQuat(const FVector& Axis, double Angle)
+    {
+        const double S = std::sin(Angle * 0.5);
+        X = Axis.X * S;
+        Y = Axis.Y * S;
+        Z = Axis.Z * S;
+        W = std::cos(Angle * 0.5);
+    }
+
+    bool operator==(const FQuat& Q) const { return X == Q.X && Y == Q.Y && Z == Q.Z && W == Q.W; }
+
+    double SizeSquared() const { return X * X + Y * Y + Z * Z + W * W; }
+
+    FQuat GetNormalized() const
+    {
+        const double Scale = 1.0 / std::sqrt(SizeSquared());
+        return FQuat(X * Scale, Y * Scale, Z * Scale, W * Scale);
+    }
+
+    // 与引擎的FQuat::Slerp相同：走短的一侧，夹角过小时线性插值，最后归一化。单元测试用它作为SlerpQuats的参照
+    static FQuat Slerp(const FQuat& Quat1, const FQuat& Quat2, double Alpha)
+    {
+        const double RawCosom = Quat1.X * Quat2.X + Quat1.Y * Quat2.Y + Quat1.Z * Quat2.Z + Quat1.W * Quat2.W;
+        const double Cosom = RawCosom >= 0.0 ? RawCosom : -RawCosom;
+
+        double Scale0 = 1.0 - Alpha;
+        double Scale1 = Alpha;
+        if (Cosom < 0.9999)
+        {
+            const double Omega = std::acos(Cosom);
+            const double InvSin = 1.0 / std::sin(Omega);
+            Scale0 = std::sin((1.0 - Alpha) * Omega) * InvSin;
+            Scale1 = std::sin(Alpha * Omega) * InvSin;
+        }
+        Scale1 = RawCosom >= 0.0 ? Scale1 : -Scale1;
+
+        return FQuat(
+            Scale0 * Quat1.X + Scale1 * Quat2.X,
+            Scale0 * Quat1.Y + Scale1 * Quat2.Y,
+            Scale0 * Quat1.Z + Scale1 * Quat2.Z,
+            Scale0 * Quat1.W + Scale1 * Quat2.W).GetNormalized();
+    }
+
+    // 两旋转之间的夹角（弧度）
+    double AngularDistance(const FQuat& Q) const
+    {
+        const double InnerProd = X * Q.X + Y * Q.Y + Z * Q.Z + W * Q.W;
+        return std::acos(std::clamp(2.0 * InnerProd * InnerProd - 1.0, -1.0, 1.0));
+    }
+};
+
+inline const FQuat FQuat::Identity(0.0, 0.0, 0.0, 1.0);
+
+// 与引擎的VectorRegister同名的标量实现，编译器可自行向量化
+struct VectorRegister4Float
+{
+    float V[4];
+};
+
+struct VectorRegister4Double
+{
+    double V[4];
+};
+
+#define LERP_STANDALONE_VECTOR_BINARY(Name, Expr) \
+    FORCEINLINE VectorRegister4Float Name(const VectorRegister4Float& A, const VectorRegister4Float& B) { VectorRegister4Float R; for (int I = 0; I < 4; ++I) { R.V[I] = Expr; } return R; } \
+    FORCEINLINE VectorRegister4Double Name(const VectorRegister4Double& A, const VectorRegister4Double& B) { VectorRegister4Double R; for (int I = 0; I < 4; ++I) { R.V[I] = Expr; } return R; }
+
+LERP_STANDALONE_VECTOR_BINARY(VectorAdd, A.V[I] + B.V[I])
+LERP_STANDALONE_VECTOR_BINARY(VectorSubtract, A.V[I] - B.V[I])
+LERP_STANDALONE_VECTOR_BINARY(VectorMultiply, A.V[I] * B.V[I])
+LERP_STANDALONE_VECTOR_BINARY(VectorDivide, A.V[I] / B.V[I])
+LERP_STANDALONE_VECTOR_BINARY(VectorMin, A.V[I] < B.V[I] ? A.V[I] : B.V[I])
+LERP_STANDALONE_VECTOR_BINARY(VectorMax, A.V[I] > B.V[I] ? A.V[I] : B.V[I])
+
+#undef LERP_STANDALONE_VECTOR_BINARY
+
+FORCEINLINE VectorRegister4Float VectorZeroFloat() { return VectorRegister4Float{ { 0.0f, 0.0f, 0.0f, 0.0f } }; }
+FORCEINLINE VectorRegister4Float VectorOneFloat() { return VectorRegister4Float{ { 1.0f, 1.0f, 1.0f, 1.0f } }; }
+
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Ptr) { VectorRegister4Float R; std::memcpy(R.V, Ptr, sizeof(R.V)); return R; }
+FORCEINLINE VectorRegister4Double VectorLoad(const double* Ptr) { VectorRegister4Double R; std::memcpy(R.V, Ptr, sizeof(R.V)); return R; }
+FORCEINLINE void VectorStore(const VectorRegister4Float& Vec, float* Ptr) { std::memcpy(Ptr, Vec.V, sizeof(Vec.V)); }
+FORCEINLINE void VectorStore(const VectorRegister4Double& Vec, double* Ptr) { std::memcpy(Ptr, Vec.V, sizeof(Vec.V)); }
+
+FORCEINLINE VectorRegister4Double VectorLoadFloat3(const double* Ptr) { return VectorRegister4Double{ { Ptr[0], Ptr[1], Ptr[2], 0.0 } }; }
+FORCEINLINE void VectorStoreFloat3(const VectorRegister4Double& Vec, double* Ptr) { Ptr[0] = Vec.V[0]; Ptr[1] = Vec.V[1]; Ptr[2] = Vec.V[2]; }
+
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float Value) { return VectorRegister4Float{ { Value, Value, Value, Value } }; }
+FORCEINLINE VectorRegister4Double VectorSetFloat1(double Value) { return VectorRegister4Double{ { Value, Value, Value, Value } }; }
+
+FORCEINLINE float VectorGetComponent(const VectorRegister4Float& Vec, int32 Component) { return Vec.V[Component]; }
+FORCEINLINE double VectorGetComponent(const VectorRegister4Double& Vec, int32 Component) { return Vec.V[Component]; }
+
+FORCEINLINE VectorRegister4Double VectorNegate(const VectorRegister4Double& Vec) { return VectorRegister4Double{ { -Vec.V[0], -Vec.V[1], -Vec.V[2], -Vec.V[3] } }; }
+
+FORCEINLINE VectorRegister4Double VectorDot4(const VectorRegister4Double& A, const VectorRegister4Double& B)
+{
+    return VectorSetFloat1(A.V[0] * B.V[0] + A.V[1] * B.V[1] + A.V[2] * B.V[2] + A.V[3] * B.V[3]);
+}
+
+FORCEINLINE VectorRegister4Double VectorNormalizeAccurate(const VectorRegister4Double& Vec)
+{
+    return VectorMultiply(Vec, VectorSetFloat1(1.0 / std::sqrt(VectorGetComponent(VectorDot4(Vec, Vec), 0))));
+}
+
+enum class EAllowShrinking : uint8
+{
+    No,
+    Yes,
+    Default = Yes,
+};
+
+// 引擎TArray的子集：连续存放，下标为int32，新增元素值初始化
+template <typename T>
+class TArray
+{
+public:
+    typedef T ElementType;
+
+    TArray() = default;
+
+    TArray(std::initializer_list<T> InitList)
+    {
+        Reserve(static_cast<int32>(InitList.size()));
+        for (const T& Element : InitList)
+        {
+            Add(Element);
+        }
+    }
+
+    TArray(const TArray& Other)
+    {
+        *this = Other;
+    }
+
+    TArray(TArray&& Other) noexcept
+        : Data(Other.Data)
+        , ArrayNum(Other.ArrayNum)
+        , ArrayMax(Other.ArrayMax)
+    {
+        Other.Data = nullptr;
+        Other.ArrayNum = 0;
+        Other.ArrayMax = 0;
+    }
+
+    ~TArray()
+    {
+        Empty();
+    }
+
+    TArray& operator=(const TArray& Other)
+    {
+        if (this != &Other)
+        {
+            Reset(Other.ArrayNum);
+            for (int32 Index = 0; Index < Other.ArrayNum; ++Index)
+            {
+                new (Data + Index) T(Other.Data[Index]);
+            }
+            ArrayNum = Other.ArrayNum;
+        }
+        return *this;
+    }
+
+    TArray& operator=(TArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Empty();
+            std::swap(Data, Other.Data);
+            std::swap(ArrayNum, Other.ArrayNum);
+            std::swap(ArrayMax, Other.ArrayMax);
+        }
+        return *this;
+    }
+
+    int32 Num() const { return ArrayNum; }
+    int32 Max() const { return ArrayMax; }
+    bool IsEmpty() const { return ArrayNum == 0; }
+    bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < ArrayNum; }
+
+    T* GetData() { return Data; }
+    const T* GetData() const { return Data; }
+
+    T& operator[](int32 Index) { checkSlow(IsValidIndex(Index)); return Data[Index]; }
+    const T& operator[](int32 Index) const { checkSlow(IsValidIndex(Index)); return Data[Index]; }
+
+    T& Last() { return Data[ArrayNum - 1]; }
+    const T& Last() const { return Data[ArrayNum - 1]; }
+
+    SIZE_T GetAllocatedSize() const { return static_cast<SIZE_T>(ArrayMax) * sizeof(T); }
+
+    void Reserve(int32 Number)
+    {
+        if (Number > ArrayMax)
+        {
+            Reallocate(Number);
+        }
+    }
+
+    template <typename... ArgsType>
+    int32 Emplace(ArgsType&&... Args)
+    {
+        Grow(ArrayNum + 1);
+        new (Data + ArrayNum) T(std::forward<ArgsType>(Args)...);
+        return ArrayNum++;
+    }
+
+    int32 Add(const T& Item) { return Emplace(Item); }
+    int32 Add(T&& Item) { return Emplace(MoveTemp(Item)); }
+
+    int32 AddDefaulted() { return Emplace(); }
+
+    // 新增的元素不初始化，只用于平凡类型
+    int32 AddUninitialized(int32 Count = 1)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "AddUninitialized requires a trivially copyable element type");
+        const int32 OldNum = ArrayNum;
+        Grow(ArrayNum + Count);
+        ArrayNum += Count;
+        return OldNum;
+    }
+
+    T Pop(EAllowShrinking AllowShrinking = EAllowShrinking::Default)
+    {
+        T Result = MoveTemp(Data[ArrayNum - 1]);
+        Data[--ArrayNum].~T();
+        MaybeShrink(AllowShrinking);
+        return Result;
+    }
+
+    void SetNum(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Default)
+    {
+        if (NewNum > ArrayNum)
+        {
+            Grow(NewNum);
+            for (int32 Index = ArrayNum; Index < NewNum; ++Index)
+            {
+                new (Data + Index) T();
+            }
+            ArrayNum = NewNum;
+        }
+        else
+        {
+            DestructRange(NewNum, ArrayNum);
+            ArrayNum = NewNum;
+            MaybeShrink(AllowShrinking);
+        }
+    }
+
+    void SetNumUninitialized(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Default)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "SetNumUninitialized requires a trivially copyable element type");
+        if (NewNum > ArrayNum)
+        {
+            Grow(NewNum);
+        }
+        ArrayNum = NewNum;
+        MaybeShrink(AllowShrinking);
+    }
+
+    void SetNumZeroed(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Default)
+    {
+        const int32 OldNum = ArrayNum;
+        SetNumUninitialized(NewNum, AllowShrinking);
+        if (NewNum > OldNum)
+        {
+            std::memset(static_cast<void*>(Data + OldNum), 0, sizeof(T) * (NewNum - OldNum));
+        }
+    }
+
+    // 用末尾的元素填补被删除的位置，不保持顺序
+    void RemoveAtSwap(int32 Index, int32 Count = 1, EAllowShrinking AllowShrinking = EAllowShrinking::Default)
+    {
+        checkSlow(Index >= 0 && Index + Count <= ArrayNum);
+        const int32 NumAfter = ArrayNum - Index - Count;
+        const int32 NumToMove = std::min(Count, NumAfter);
+        for (int32 Offset = 0; Offset < NumToMove; ++Offset)
+        {
+            Data[Index + Offset] = MoveTemp(Data[ArrayNum - NumToMove + Offset]);
+        }
+        DestructRange(ArrayNum - Count, ArrayNum);
+        ArrayNum -= Count;
+        MaybeShrink(AllowShrinking);
+    }
+
+    void RemoveAt(int32 Index, int32 Count = 1, EAllowShrinking AllowShrinking = EAllowShrinking::Default)
+    {
+        checkSlow(Index >= 0 && Index + Count <= ArrayNum);
+        std::move(Data + Index + Count, Data + ArrayNum, Data + Index);
+        DestructRange(ArrayNum - Count, ArrayNum);
+        ArrayNum -= Count;
+        MaybeShrink(AllowShrinking);
+    }
+
+    // 清空元素但保留至少NewSize的容量
+    void Reset(int32 NewSize = 0)
+    {
+        DestructRange(0, ArrayNum);
+        ArrayNum = 0;
+        Reserve(NewSize);
+    }
+
+    void Empty()
+    {
+        DestructRange(0, ArrayNum);
+        ArrayNum = 0;
+        if (Data)
+        {
+            ::operator delete(static_cast<void*>(Data), std::align_val_t(alignof(T)));
+            Data = nullptr;
+        }
+        ArrayMax = 0;
+    }
+
+    T* begin() { return Data; }
+    T* end() { return Data + ArrayNum; }
+    const T* begin() const { return Data; }
+    const T* end() const { return Data + ArrayNum; }
+
+private:
+    void Grow(int32 MinMax)
+    {
+        if (MinMax > ArrayMax)
+        {
+            Reallocate(std::max(MinMax, ArrayMax + ArrayMax / 2 + 4));
+        }
+    }
+
+    void MaybeShrink(EAllowShrinking AllowShrinking)
+    {
+        if (AllowShrinking == EAllowShrinking::Yes && ArrayNum < ArrayMax / 2)
+        {
+            Reallocate(ArrayNum);
+        }
+    }
+
+    void Reallocate(int32 NewMax)
+    {
+        T* NewData = NewMax > 0 ? static_cast<T*>(::operator new(sizeof(T) * NewMax, std::align_val_t(alignof(T)))) : nullptr;
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (ArrayNum > 0)
+            {
+                std::memcpy(static_cast<void*>(NewData), Data, sizeof(T) * ArrayNum);
+            }
+        }
+        else
+        {
+            for (int32 Index = 0; Index < ArrayNum; ++Index)
+            {
+                new (NewData + Index) T(MoveTemp(Data[Index]));
+                Data[Index].~T();
+            }
+        }
+        if (Data)
+        {
+            ::operator delete(static_cast<void*>(Data), std::align_val_t(alignof(T)));
+        }
+        Data = NewData;
+        ArrayMax = NewMax;
+    }
+
+    void DestructRange(int32 First, int32 Last)
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (int32 Index = First; Index < Last; ++Index)
+            {
+                Data[Index].~T();
+            }
+        }
+    }
+
+    T* Data = nullptr;
+    int32 ArrayNum = 0;
+    int32 ArrayMax = 0;
+};
+
+// 把[0, Num)分给若干工作线程执行，返回前等待全部完成。bForceSingleThread时在当前线程顺序执行
+void ParallelFor(int32 Num, const std::function<void(int32)>& Body, bool bForceSingleThread = false);
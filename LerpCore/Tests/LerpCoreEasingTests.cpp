@@ -0,0 +1,120 @@
+#include "../LerpCorePlatform.h"
+
+#if LERP_CORE_STANDALONE
+
+#include "LerpCoreTest.h"
+#include "../LerpCoreEasing.h"
+
+namespace
+{
+    // 不依赖曲线表的缓动：Linear到Step
+    constexpr int32 NumAnalyticEases = static_cast<int32>(ELerpEase::Step) + 1;
+
+    // 写入一张0~Scale的线性表
+    int32 AddRampTable(LerpEasing::FLerpSampleTables& Tables, float Scale)
+    {
+        constexpr int32 NumSamples = LerpEasing::FLerpSampleTables::NumSamples;
+        const int32 TableIndex = Tables.Add(1);
+        float* Samples = Tables.GetSamples(TableIndex);
+        for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+        {
+            Samples[Sample] = Scale * Sample / (NumSamples - 1);
+        }
+        return TableIndex;
+    }
+}
+
+LERP_TEST(EasesHitBothEndpoints)
+{
+    const LerpEasing::FLerpSampleTables Tables;
+    for (int32 EaseIndex = 0; EaseIndex < NumAnalyticEases; ++EaseIndex)
+    {
+        const ELerpEase Ease = static_cast<ELerpEase>(EaseIndex);
+        LERP_CHECK(FMath::Abs(LerpEasing::EvaluateEase(Ease, INDEX_NONE, Tables, 0.0f)) <= 1.e-6f);
+        LERP_CHECK(FMath::Abs(LerpEasing::EvaluateEase(Ease, INDEX_NONE, Tables, 1.0f) - 1.0f) <= 1.e-6f);
+    }
+
+    // Step到时长结束才跳到终点
+    LERP_CHECK(LerpEasing::Evaluate<ELerpEase::Step>(0.999f) == 0.0f);
+    LERP_CHECK(LerpEasing::Evaluate<ELerpEase::Linear>(0.25f) == 0.25f);
+}
+
+LERP_TEST(BatchedEasesMatchSingleEvaluation)
+{
+    LerpEasing::FLerpSampleTables Tables;
+    const int32 CurveTable = AddRampTable(Tables, 2.0f);
+
+    // 各种缓动交错排列，分桶后的特化循环与逐个求值逐位相同
+    constexpr int32 Num = 1000;
+    TArray<ELerpEase> Eases;
+    TArray<int32> CurveTableIndices;
+    TArray<float> Inputs;
+    TArray<float> Alphas;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const bool bCurve = Index % (NumAnalyticEases + 1) == NumAnalyticEases;
+        Eases.Add(bCurve ? ELerpEase::Curve : static_cast<ELerpEase>(Index % (NumAnalyticEases + 1)));
+        CurveTableIndices.Add(bCurve ? CurveTable : INDEX_NONE);
+        Inputs.Add(static_cast<float>(Index) / (Num - 1));
+    }
+    Alphas = Inputs;
+
+    TArray<int32> ScratchRows;
+    LerpEasing::ApplyEases(Eases.GetData(), CurveTableIndices.GetData(), Tables, Alphas.GetData(), Num, ScratchRows);
+
+    bool bMatches = true;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        bMatches &= Alphas[Index] == LerpEasing::EvaluateEase(Eases[Index], CurveTableIndices[Index], Tables, Inputs[Index]);
+    }
+    LERP_CHECK(bMatches);
+}
+
+LERP_TEST(SampleTableLookupFiltersBetweenSamples)
+{
+    LerpEasing::FLerpSampleTables Tables;
+    const int32 TableIndex = AddRampTable(Tables, 2.0f);
+
+    LERP_CHECK(Tables.EvaluateFloat(TableIndex, 0.0f) == 0.0f);
+    LERP_CHECK(FMath::Abs(Tables.EvaluateFloat(TableIndex, 1.0f) - 2.0f) <= 1.e-6f);
+    LERP_CHECK(FMath::Abs(Tables.EvaluateFloat(TableIndex, 0.3f) - 0.6f) <= 1.e-5f);
+    // 超出0~1时取端点
+    LERP_CHECK(Tables.EvaluateFloat(TableIndex, -1.0f) == 0.0f);
+    LERP_CHECK(FMath::Abs(Tables.EvaluateFloat(TableIndex, 2.0f) - 2.0f) <= 1.e-6f);
+    LERP_CHECK(LerpEasing::EvaluateEase(ELerpEase::Curve, TableIndex, Tables, 0.3f) == Tables.EvaluateFloat(TableIndex, 0.3f));
+
+    // 向量表逐点存放3个分量
+    constexpr int32 NumSamples = LerpEasing::FLerpSampleTables::NumSamples;
+    const int32 VectorTable = Tables.Add(3);
+    float* Samples = Tables.GetSamples(VectorTable);
+    for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+    {
+        const float T = static_cast<float>(Sample) / (NumSamples - 1);
+        Samples[Sample * 3] = T;
+        Samples[Sample * 3 + 1] = 1.0f - T;
+        Samples[Sample * 3 + 2] = 0.5f;
+    }
+    const FVector End = Tables.EvaluateVector(VectorTable, 1.0f);
+    LERP_CHECK(FMath::Abs(End.X - 1.0) <= 1.e-6 && FMath::Abs(End.Y) <= 1.e-6 && End.Z == 0.5);
+}
+
+LERP_TEST(SampleTablesAreSharedByReference)
+{
+    LerpEasing::FLerpSampleTables Tables;
+    const int32 First = AddRampTable(Tables, 1.0f);
+    const int32 Second = AddRampTable(Tables, 1.0f);
+    LERP_CHECK(First != Second && Tables.Num() == 2);
+
+    // 两个tween共用一张表，最后一个释放时表才被回收
+    Tables.AddRef(First);
+    LERP_CHECK(!Tables.Release(First));
+    LERP_CHECK(Tables.Num() == 2);
+    LERP_CHECK(Tables.Release(First));
+    LERP_CHECK(Tables.Num() == 1);
+
+    // 释放的下标被新表复用
+    LERP_CHECK(Tables.Add(1) == First);
+    LERP_CHECK(Tables.Num() == 2);
+}
+
+#endif
@@ -0,0 +1,179 @@
+#include "../LerpCorePlatform.h"
+
+#if LERP_CORE_STANDALONE
+
+#include "LerpCoreTest.h"
+#include "../LerpCoreKernels.h"
+
+#include <random>
+
+// 内核与逐个调用FMath::Lerp的标量写法比较：推进和线性插值要求逐位相同，Slerp与FQuat::Slerp在舍入误差以内。
+// 行数覆盖不足4个、恰好4的倍数和带尾部的情况
+
+namespace
+{
+    const int32 RowCounts[] = { 1, 2, 3, 4, 5, 7, 8, 1027 };
+
+    // 引擎内的自动化测试以KINDA_SMALL_NUMBER为限，这里收紧到1e-6弧度
+    constexpr double SlerpTolerance = 1.e-6;
+
+    FVector RandomVector(std::mt19937& Random, double Extent)
+    {
+        std::uniform_real_distribution<double> Distribution(-Extent, Extent);
+        return FVector(Distribution(Random), Distribution(Random), Distribution(Random));
+    }
+
+    FQuat RandomQuat(std::mt19937& Random)
+    {
+        FVector Axis = RandomVector(Random, 1.0);
+        while (Axis.SizeSquared() < 1.e-4)
+        {
+            Axis = RandomVector(Random, 1.0);
+        }
+        return FQuat(Axis / Axis.Size(), std::uniform_real_distribution<double>(-UE_PI, UE_PI)(Random));
+    }
+
+    TArray<float> RandomFloats(std::mt19937& Random, int32 Num, float Min, float Max)
+    {
+        std::uniform_real_distribution<float> Distribution(Min, Max);
+        TArray<float> Values;
+        Values.SetNumUninitialized(Num);
+        for (float& Value : Values)
+        {
+            Value = Distribution(Random);
+        }
+        return Values;
+    }
+}
+
+LERP_TEST(AdvanceAlphasMatchesScalarPath)
+{
+    std::mt19937 Random(9);
+    bool bMatches = true;
+    for (const int32 Num : RowCounts)
+    {
+        const TArray<float> Durations = RandomFloats(Random, Num, 0.01f, 5.0f);
+        const TArray<float> Deltas = RandomFloats(Random, Num, 0.0f, 0.1f);
+        // 包括延迟中（负数）和已经越过时长的行
+        TArray<float> Elapsed = RandomFloats(Random, Num, -1.0f, 6.0f);
+        TArray<float> Expected = Elapsed;
+        TArray<float> Alphas;
+        Alphas.SetNumUninitialized(Num);
+
+        LerpBatchKernels::AdvanceAlphas(Elapsed.GetData(), Deltas.GetData(), Durations.GetData(), Alphas.GetData(), Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Expected[Index] += Deltas[Index];
+            const float ExpectedAlpha = FMath::Clamp(Expected[Index] / Durations[Index], 0.0f, 1.0f);
+            bMatches &= Elapsed[Index] == Expected[Index] && Alphas[Index] == ExpectedAlpha;
+        }
+    }
+    LERP_CHECK(bMatches);
+}
+
+LERP_TEST(LerpFloatsMatchesFMathLerp)
+{
+    std::mt19937 Random(10);
+    bool bMatches = true;
+    for (const int32 Num : RowCounts)
+    {
+        const TArray<float> Starts = RandomFloats(Random, Num, -1000.0f, 1000.0f);
+        const TArray<float> Ends = RandomFloats(Random, Num, -1000.0f, 1000.0f);
+        const TArray<float> Alphas = RandomFloats(Random, Num, 0.0f, 1.0f);
+        TArray<float> Out;
+        Out.SetNumUninitialized(Num);
+
+        LerpBatchKernels::LerpFloats(Starts.GetData(), Ends.GetData(), Alphas.GetData(), Out.GetData(), Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            bMatches &= Out[Index] == FMath::Lerp(Starts[Index], Ends[Index], Alphas[Index]);
+        }
+    }
+    LERP_CHECK(bMatches);
+}
+
+LERP_TEST(LerpVectorsMatchesFMathLerp)
+{
+    std::mt19937 Random(11);
+    bool bMatches = true;
+    for (const int32 Num : RowCounts)
+    {
+        TArray<FVector> Starts;
+        TArray<FVector> Ends;
+        TArray<FVector> Out;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Starts.Add(RandomVector(Random, 100000.0));
+            Ends.Add(RandomVector(Random, 100000.0));
+        }
+        Out.SetNumZeroed(Num);
+        const TArray<float> Alphas = RandomFloats(Random, Num, 0.0f, 1.0f);
+
+        LerpBatchKernels::LerpVectors(Starts.GetData(), Ends.GetData(), Alphas.GetData(), Out.GetData(), Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            bMatches &= Out[Index] == FMath::Lerp(Starts[Index], Ends[Index], Alphas[Index]);
+        }
+    }
+    LERP_CHECK(bMatches);
+}
+
+LERP_TEST(SlerpQuatsMatchesFQuatSlerp)
+{
+    std::mt19937 Random(12);
+    double MaxError = 0.0;
+    for (const int32 Num : RowCounts)
+    {
+        TArray<FQuat> Starts;
+        TArray<FQuat> Ends;
+        TArray<FQuat> Out;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const FQuat Start = RandomQuat(Random);
+            FQuat End = RandomQuat(Random);
+            if (Index % 3 == 1)
+            {
+                // 几乎相同的两端，走线性插值的分支
+                End = FQuat(Start.X + 1.e-5, Start.Y, Start.Z, Start.W).GetNormalized();
+            }
+            else if (Index % 3 == 2)
+            {
+                // 点积为负，应走短的一侧
+                End = FQuat(-End.X, -End.Y, -End.Z, -End.W);
+            }
+            Starts.Add(Start);
+            Ends.Add(End);
+        }
+        Out.SetNumZeroed(Num);
+        const TArray<float> Alphas = RandomFloats(Random, Num, 0.0f, 1.0f);
+
+        LerpBatchKernels::SlerpQuats(Starts.GetData(), Ends.GetData(), Alphas.GetData(), Out.GetData(), Num, 0.0f);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const FQuat Expected = FQuat::Slerp(Starts[Index], Ends[Index], Alphas[Index]);
+            MaxError = FMath::Max(MaxError, Out[Index].AngularDistance(Expected));
+            LERP_CHECK(FMath::Abs(Out[Index].SizeSquared() - 1.0) <= 1.e-9);
+        }
+    }
+    LERP_CHECK(MaxError <= SlerpTolerance);
+}
+
+LERP_TEST(SlerpQuatsKeepsSlerpAboveNlerpAngle)
+{
+    // 夹角90度，超过NlerpMaxAngle的10度，仍按Slerp匀速插值
+    const FQuat Start = FQuat::Identity;
+    const FQuat End(FVector(0.0, 0.0, 1.0), UE_PI * 0.5);
+    const float Alpha = 0.25f;
+    FQuat Out;
+    LerpBatchKernels::SlerpQuats(&Start, &End, &Alpha, &Out, 1, 10.0f);
+    LERP_CHECK(Out.AngularDistance(FQuat::Slerp(Start, End, Alpha)) <= SlerpTolerance);
+    LERP_CHECK(FMath::Abs(Out.AngularDistance(Start) - UE_PI * 0.125) <= SlerpTolerance);
+
+    // 夹角小于阈值时改用Nlerp，结果仍是单位四元数且与Slerp相差很小
+    const FQuat Near(FVector(0.0, 0.0, 1.0), FMath::DegreesToRadians(5.0));
+    LerpBatchKernels::SlerpQuats(&Start, &Near, &Alpha, &Out, 1, 10.0f);
+    LERP_CHECK(FMath::Abs(Out.SizeSquared() - 1.0) <= 1.e-9);
+    LERP_CHECK(Out.AngularDistance(FQuat::Slerp(Start, Near, Alpha)) <= 1.e-3);
+}
+
+#endif
@@ -0,0 +1,223 @@
+#include "../LerpCorePlatform.h"
+
+#if LERP_CORE_STANDALONE
+
+#include "LerpCoreTest.h"
+#include "../LerpCoreStep.h"
+
+#include <atomic>
+#include <random>
+
+using LerpCoreTest::FTestTweens;
+
+namespace
+{
+    constexpr float StepTime = 1.0f / 60.0f;
+
+    int32 AddTestTween(FTestTweens& Tweens, float Duration, ELerpTweenFlags Flags = ELerpTweenFlags::None, float Dilation = 1.0f)
+    {
+        FLerpTimeSource TimeSource;
+        TimeSource.Dilation = Dilation;
+        const int32 Index = LerpTweenStorage::AddTween(Tweens, Duration, Flags, TimeSource);
+        Tweens.SlotIndices[Index] = Index;
+        return Index;
+    }
+
+    // 与ULerpSubsystem的一步相同：整理后整批推进
+    struct FTestStepper
+    {
+        FLerpStepColumns Step;
+        LerpEasing::FLerpSampleTables Tables;
+        TArray<TArray<int32>> EaseRows;
+        uint32 StepIndex = 0;
+
+        void Run(FTestTweens& Tweens, float DeltaTime, int32 ParallelThreshold = 0)
+        {
+            LerpTweenStep::GatherStep(Tweens, Step, DeltaTime, StepIndex++, ParallelThreshold);
+            LerpTweenStep::AdvanceTweens(Tweens, Step, Tables, ParallelThreshold, EaseRows);
+        }
+    };
+}
+
+LERP_TEST(StepFinishesByElapsedTime)
+{
+    FTestTweens Tweens;
+    AddTestTween(Tweens, 0.1f);
+    AddTestTween(Tweens, 0.2f);
+    AddTestTween(Tweens, 1.0f);
+
+    FTestStepper Stepper;
+    Stepper.Run(Tweens, 0.1f);
+    LERP_CHECK(Stepper.Step.Finished[0] && !Stepper.Step.Finished[1] && !Stepper.Step.Finished[2]);
+    LERP_CHECK(Stepper.Step.Alphas[0] == 1.0f);
+    LERP_CHECK(Stepper.Step.Alphas[1] == 0.5f);
+
+    // 越过时长后Alpha停在1
+    Stepper.Run(Tweens, 0.15f);
+    LERP_CHECK(Stepper.Step.Finished[1] && !Stepper.Step.Finished[2]);
+    LERP_CHECK(Stepper.Step.Alphas[0] == 1.0f && Stepper.Step.Alphas[1] == 1.0f);
+    LERP_CHECK(Stepper.Step.Active[0] && Stepper.Step.Active[1] && Stepper.Step.Active[2]);
+}
+
+LERP_TEST(StepAppliesEaseAfterClamp)
+{
+    FTestTweens Tweens;
+    const int32 Index = AddTestTween(Tweens, 1.0f);
+    Tweens.Eases[Index] = ELerpEase::QuadIn;
+
+    FTestStepper Stepper;
+    Stepper.Run(Tweens, 0.5f);
+    LERP_CHECK(Stepper.Step.Alphas[Index] == LerpEasing::Evaluate<ELerpEase::QuadIn>(0.5f));
+    LERP_CHECK(Tweens.Elapsed[Index] == 0.5f);
+}
+
+LERP_TEST(StepHoldsPausedAndQueuedRows)
+{
+    FTestTweens Tweens;
+    AddTestTween(Tweens, 1.0f, ELerpTweenFlags::Paused);
+    AddTestTween(Tweens, 1.0f, ELerpTweenFlags::Queued);
+
+    FTestStepper Stepper;
+    Stepper.Run(Tweens, 0.5f);
+    for (int32 Index = 0; Index < Tweens.Num(); ++Index)
+    {
+        LERP_CHECK(!Stepper.Step.Active[Index]);
+        LERP_CHECK(Stepper.Step.Deltas[Index] == 0.0f);
+        LERP_CHECK(Tweens.Elapsed[Index] == 0.0f);
+    }
+}
+
+LERP_TEST(StepScalesByTimeSourceDilation)
+{
+    FTestTweens Tweens;
+    const int32 Index = AddTestTween(Tweens, 1.0f, ELerpTweenFlags::None, 2.0f);
+
+    FTestStepper Stepper;
+    Stepper.Run(Tweens, 0.25f);
+    LERP_CHECK(Tweens.Elapsed[Index] == 0.5f);
+}
+
+LERP_TEST(StepDelaysRowsWithNegativeElapsed)
+{
+    FTestTweens Tweens;
+    const int32 Index = AddTestTween(Tweens, 0.1f, ELerpTweenFlags::CaptureStart);
+    Tweens.Elapsed[Index] = -0.1f;
+
+    // 延迟期间只计时，不推进，起点还要在开始那一步之前读回
+    FTestStepper Stepper;
+    Stepper.Run(Tweens, 0.06f);
+    LERP_CHECK(!Stepper.Step.Active[Index] && !Stepper.Step.Finished[Index]);
+    LERP_CHECK(LerpTweenStep::IsDelayed(Tweens, Index));
+    LERP_CHECK(EnumHasAnyFlags(Tweens.Flags[Index], ELerpTweenFlags::CaptureStart));
+
+    // 越过0的那一步开始推进，并清掉CaptureStart
+    Stepper.Run(Tweens, 0.06f);
+    LERP_CHECK(Stepper.Step.Active[Index] && !Stepper.Step.Finished[Index]);
+    LERP_CHECK(!LerpTweenStep::IsDelayed(Tweens, Index));
+    LERP_CHECK(!EnumHasAnyFlags(Tweens.Flags[Index], ELerpTweenFlags::CaptureStart));
+    LERP_CHECK(FMath::Abs(Stepper.Step.Alphas[Index] - 0.2f) <= 1.e-5f);
+
+    // 延迟加时长之后结束
+    Stepper.Run(Tweens, 0.06f);
+    LERP_CHECK(!Stepper.Step.Finished[Index]);
+    Stepper.Run(Tweens, 0.06f);
+    LERP_CHECK(Stepper.Step.Finished[Index] && Stepper.Step.Alphas[Index] == 1.0f);
+}
+
+LERP_TEST(StepStrideDefersSkippedTime)
+{
+    FTestTweens Tweens;
+    const int32 Index = AddTestTween(Tweens, 10.0f);
+    Tweens.Strides[Index] = 3;
+
+    // 每3步推进一次，跳过的时间攒到轮到的那一步，总时间不丢
+    FTestStepper Stepper;
+    int32 NumActive = 0;
+    for (int32 Step = 0; Step < 6; ++Step)
+    {
+        Stepper.Run(Tweens, 0.25f);
+        NumActive += Stepper.Step.Active[Index] ? 1 : 0;
+    }
+    LERP_CHECK(NumActive == 2);
+    LERP_CHECK(Tweens.Elapsed[Index] + Tweens.DeferredTimes[Index] == 1.5f);
+
+    // 攒下的时间已够走完时不再等
+    FTestTweens Short;
+    const int32 ShortIndex = AddTestTween(Short, 0.3f);
+    Short.SlotIndices[ShortIndex] = 1;
+    Short.Strides[ShortIndex] = 100;
+    FTestStepper ShortStepper;
+    ShortStepper.Run(Short, 0.2f);
+    ShortStepper.Run(Short, 0.2f);
+    LERP_CHECK(ShortStepper.Step.Active[ShortIndex] && ShortStepper.Step.Finished[ShortIndex]);
+}
+
+LERP_TEST(ParallelForVisitsEveryIndexOnce)
+{
+    constexpr int32 Num = 10000;
+    TArray<std::atomic<int32>> Counts;
+    Counts.SetNum(Num);
+    for (std::atomic<int32>& Count : Counts)
+    {
+        Count = 0;
+    }
+
+    ParallelFor(Num, [&Counts](int32 Index)
+    {
+        ++Counts[Index];
+    });
+
+    bool bOnce = true;
+    for (const std::atomic<int32>& Count : Counts)
+    {
+        bOnce &= Count == 1;
+    }
+    LERP_CHECK(bOnce);
+}
+
+LERP_TEST(ChunkedStepMatchesSerialStep)
+{
+    // 跨多块、末块不满；缓动、倍率、降频、暂停和延迟都混在一起
+    constexpr int32 Num = LerpTweenStep::StepChunkSize * 4 + 37;
+    constexpr int32 NumEases = static_cast<int32>(ELerpEase::Step) + 1;
+    std::mt19937 Random(2024);
+    std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+
+    FTestTweens Serial;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const ELerpTweenFlags Flags = Index % 17 == 0 ? ELerpTweenFlags::Paused : ELerpTweenFlags::None;
+        AddTestTween(Serial, 0.1f + Unit(Random) * 2.0f, Flags, 0.5f + Unit(Random));
+        Serial.Eases[Index] = static_cast<ELerpEase>(Index % NumEases);
+        Serial.Strides[Index] = static_cast<uint8>(1 + Index % 4);
+        Serial.Elapsed[Index] = Index % 5 == 0 ? -Unit(Random) * 0.2f : 0.0f;
+    }
+    FTestTweens Chunked = Serial;
+
+    FTestStepper SerialStepper;
+    FTestStepper ChunkedStepper;
+    bool bMatches = true;
+    for (int32 Step = 0; Step < 90; ++Step)
+    {
+        SerialStepper.Run(Serial, StepTime, 0);
+        ChunkedStepper.Run(Chunked, StepTime, 1);
+
+        const FLerpStepColumns& A = SerialStepper.Step;
+        const FLerpStepColumns& B = ChunkedStepper.Step;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            bMatches &= Serial.Elapsed[Index] == Chunked.Elapsed[Index]
+                && Serial.DeferredTimes[Index] == Chunked.DeferredTimes[Index]
+                && Serial.Flags[Index] == Chunked.Flags[Index]
+                && A.Deltas[Index] == B.Deltas[Index]
+                && A.Alphas[Index] == B.Alphas[Index]
+                && A.Active[Index] == B.Active[Index]
+                && A.Finished[Index] == B.Finished[Index];
+        }
+    }
+    LERP_CHECK(bMatches);
+    LERP_CHECK(LerpTweenStep::GetNumStepChunks(Num, 1) == 5);
+    LERP_CHECK(LerpTweenStep::GetNumStepChunks(Num, 0) == 1);
+}
+
+#endif
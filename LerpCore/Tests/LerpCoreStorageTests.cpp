@@ -0,0 +1,174 @@
+#include "../LerpCorePlatform.h"
+
+#if LERP_CORE_STANDALONE
+
+#include "LerpCoreTest.h"
+
+using LerpCoreTest::FTestTweens;
+
+namespace
+{
+    int32 AddTestTween(FTestTweens& Tweens, float End)
+    {
+        const int32 Index = LerpTweenStorage::AddTween(Tweens, 1.0f, ELerpTweenFlags::None, FLerpTimeSource());
+        Tweens.SlotIndices[Index] = Index;
+        Tweens.Ends[Index] = End;
+        return Index;
+    }
+
+    bool AreColumnsAligned(FTestTweens& Tweens)
+    {
+        bool bAligned = true;
+        const int32 Num = Tweens.Num();
+        Tweens.ForEachColumn([&bAligned, Num](auto& Column)
+        {
+            bAligned &= Column.Num() == Num;
+        });
+        return bAligned;
+    }
+}
+
+LERP_TEST(SlotPoolReusesFreedSlotWithNewGeneration)
+{
+    FLerpSlotPool Pool;
+    const FLerpHandle First = Pool.Allocate(ELerpTweenKind::Vector, 0);
+    const FLerpHandle Second = Pool.Allocate(ELerpTweenKind::Quat, 0);
+    LERP_CHECK(First.Index != Second.Index);
+    LERP_CHECK(Pool.GetNumActive() == 2);
+
+    Pool.Release(First.Index);
+    LERP_CHECK(Pool.Find(First) == nullptr);
+    LERP_CHECK(Pool.Find(Second) != nullptr);
+    LERP_CHECK(Pool.GetNumActive() == 1);
+
+    // 空闲链表优先复用，池子不增长，旧句柄因代数不同而失效
+    const FLerpHandle Third = Pool.Allocate(ELerpTweenKind::Scalar, 5);
+    LERP_CHECK(Third.Index == First.Index);
+    LERP_CHECK(Third.Generation == First.Generation + 1);
+    LERP_CHECK(Pool.GetCapacity() == 2);
+    LERP_CHECK(Pool.Find(First) == nullptr);
+
+    const FLerpSlot* Slot = Pool.Find(Third);
+    LERP_CHECK(Slot && Slot->Kind == ELerpTweenKind::Scalar && Slot->DenseIndex == 5);
+}
+
+LERP_TEST(SlotPoolFreeListIsLastInFirstOut)
+{
+    FLerpSlotPool Pool;
+    FLerpHandle Handles[4];
+    for (FLerpHandle& Handle : Handles)
+    {
+        Handle = Pool.Allocate(ELerpTweenKind::Vector, 0);
+    }
+
+    Pool.Release(Handles[1].Index);
+    Pool.Release(Handles[3].Index);
+    LERP_CHECK(Pool.Allocate(ELerpTweenKind::Vector, 0).Index == Handles[3].Index);
+    LERP_CHECK(Pool.Allocate(ELerpTweenKind::Vector, 0).Index == Handles[1].Index);
+    LERP_CHECK(Pool.Allocate(ELerpTweenKind::Vector, 0).Index == 4);
+    LERP_CHECK(Pool.GetCapacity() == 5);
+}
+
+LERP_TEST(SlotPoolGenerationSkipsZero)
+{
+    FLerpSlotPool Pool;
+    LERP_CHECK(Pool.Find(FLerpHandle()) == nullptr);
+
+    const FLerpHandle Handle = Pool.Allocate(ELerpTweenKind::Vector, 0);
+    LERP_CHECK(Handle.Generation != 0);
+
+    // 代数到顶后回到1，0保留给默认构造的空句柄
+    Pool[Handle.Index].Generation = MAX_uint32;
+    Pool.Release(Handle.Index);
+    const FLerpHandle Reused = Pool.Allocate(ELerpTweenKind::Vector, 0);
+    LERP_CHECK(Reused.Index == Handle.Index && Reused.Generation == 1);
+
+    FLerpHandle ZeroGeneration = Reused;
+    ZeroGeneration.Generation = 0;
+    LERP_CHECK(Pool.Find(ZeroGeneration) == nullptr);
+}
+
+LERP_TEST(SlotPoolReleaseClearsChannel)
+{
+    FLerpSlotPool Pool;
+    const FLerpHandle Handle = Pool.Allocate(ELerpTweenKind::Vector, 0);
+    int32 Target = 0;
+    Pool[Handle.Index].ChannelKey = FLerpChannelKey(&Target, ELerpChannel::Rotation);
+    Pool[Handle.Index].NextQueued = 7;
+    Pool.Release(Handle.Index);
+
+    const FLerpHandle Reused = Pool.Allocate(ELerpTweenKind::Vector, 0);
+    LERP_CHECK(Pool[Reused.Index].ChannelKey == FLerpChannelKey());
+    LERP_CHECK(Pool[Reused.Index].NextQueued == INDEX_NONE);
+}
+
+LERP_TEST(ChannelKeyDistinguishesSubKey)
+{
+    // 同一材质上不同名字的参数是不同通道，同名参数是同一通道
+    int32 Target = 0;
+    const FLerpChannelKey First(&Target, ELerpChannel::Parameter, 1);
+    const FLerpChannelKey Second(&Target, ELerpChannel::Parameter, 2);
+    LERP_CHECK(!(First == Second));
+    LERP_CHECK(First == FLerpChannelKey(&Target, ELerpChannel::Parameter, 1));
+    LERP_CHECK(!(FLerpChannelKey(&Target, ELerpChannel::Parameter) == FLerpChannelKey(&Target, ELerpChannel::Float)));
+    LERP_CHECK(GetTypeHash(First) == GetTypeHash(FLerpChannelKey(&Target, ELerpChannel::Parameter, 1)));
+}
+
+LERP_TEST(AddTweenFillsDefaults)
+{
+    FTestTweens Tweens;
+    FLerpTimeSource TimeSource;
+    TimeSource.Dilation = 0.5f;
+    const int32 Index = LerpTweenStorage::AddTween(Tweens, 2.0f, ELerpTweenFlags::Paused, TimeSource);
+
+    LERP_CHECK(Index == 0 && Tweens.Num() == 1);
+    LERP_CHECK(AreColumnsAligned(Tweens));
+    LERP_CHECK(Tweens.Elapsed[Index] == 0.0f);
+    LERP_CHECK(Tweens.Durations[Index] == 2.0f);
+    LERP_CHECK(Tweens.Flags[Index] == ELerpTweenFlags::Paused);
+    LERP_CHECK(Tweens.TimeSources[Index].Dilation == 0.5f);
+    LERP_CHECK(Tweens.Eases[Index] == ELerpEase::Linear);
+    LERP_CHECK(Tweens.CurveTableIndices[Index] == INDEX_NONE);
+    LERP_CHECK(Tweens.Strides[Index] == 1);
+    LERP_CHECK(Tweens.DeferredTimes[Index] == 0.0f);
+}
+
+LERP_TEST(RemoveTweenSwapsInLastRow)
+{
+    FTestTweens Tweens;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        AddTestTween(Tweens, static_cast<float>(Index));
+    }
+
+    // 中间的行由最后一行填补，所有列一起挪动
+    LerpTweenStorage::RemoveTween(Tweens, 1);
+    LERP_CHECK(Tweens.Num() == 3);
+    LERP_CHECK(AreColumnsAligned(Tweens));
+    LERP_CHECK(Tweens.Ends[0] == 0.0f && Tweens.Ends[1] == 3.0f && Tweens.Ends[2] == 2.0f);
+    LERP_CHECK(Tweens.SlotIndices[1] == 3);
+
+    // 删除最后一行不挪动其他行
+    LerpTweenStorage::RemoveTween(Tweens, 2);
+    LERP_CHECK(Tweens.Num() == 2);
+    LERP_CHECK(Tweens.Ends[0] == 0.0f && Tweens.Ends[1] == 3.0f);
+
+    // 删除不收缩内存
+    LERP_CHECK(Tweens.Ends.Max() >= 4);
+}
+
+LERP_TEST(ReserveCoversEveryColumn)
+{
+    FTestTweens Tweens;
+    AddTestTween(Tweens, 1.0f);
+    LerpTweenStorage::Reserve(Tweens, 100);
+
+    bool bReserved = true;
+    Tweens.ForEachColumn([&bReserved](auto& Column)
+    {
+        bReserved &= Column.Max() >= 100 && Column.Num() == 1;
+    });
+    LERP_CHECK(bReserved);
+}
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../LerpCoreStorage.h"
+
+// LerpCoreTests用的最小测试框架：LERP_TEST定义并登记一个测试，LERP_CHECK失败时记下位置后继续执行，
+// 由LerpCoreTestMain.cpp逐个运行，有失败时进程返回非0，供CTest判定
+namespace LerpCoreTest
+{
+    using FTestFunction = void (*)();
+
+    bool Register(const char* Name, FTestFunction Function);
+
+    void ReportFailure(const char* File, int32 Line, const char* Expression);
+
+    // 测试用的一种tween：公共列之外只带一列标量终点
+    struct FTestTweens : public FLerpTweenColumns
+    {
+        TArray<float> Ends;
+
+        template <typename FuncType>
+        void ForEachColumn(FuncType&& Func)
+        {
+            Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+            Func(Ends);
+        }
+    };
+}
+
+#define LERP_TEST(Name) \
+    static void Name(); \
+    [[maybe_unused]] static const bool Name##Registered = LerpCoreTest::Register(#Name, &Name); \
+    static void Name()
+
+#define LERP_CHECK(Expression) \
+    do \
+    { \
+        if (!(Expression)) \
+        { \
+            LerpCoreTest::ReportFailure(__FILE__, __LINE__, #Expression); \
+        } \
+    } while (0)
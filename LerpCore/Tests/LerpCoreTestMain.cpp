@@ -0,0 +1,70 @@
+#include "../LerpCorePlatform.h"
+
+// 只在独立构建时编译；引擎内编译这个文件为空
+#if LERP_CORE_STANDALONE
+
+#include "LerpCoreTest.h"
+
+#include <cstdio>
+#include <cstring>
+
+//     LerpCoreTests [名称中包含的子串]
+
+namespace
+{
+    struct FTestCase
+    {
+        const char* Name;
+        LerpCoreTest::FTestFunction Function;
+    };
+
+    // 各测试文件在静态初始化时登记，用函数内的静态变量避开初始化顺序问题
+    TArray<FTestCase>& GetTests()
+    {
+        static TArray<FTestCase> Tests;
+        return Tests;
+    }
+
+    int32 NumFailures = 0;
+}
+
+namespace LerpCoreTest
+{
+    bool Register(const char* Name, FTestFunction Function)
+    {
+        GetTests().Add({ Name, Function });
+        return true;
+    }
+
+    void ReportFailure(const char* File, int32 Line, const char* Expression)
+    {
+        std::printf("    %s:%d: LERP_CHECK(%s) failed\n", File, Line, Expression);
+        ++NumFailures;
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    const char* Filter = Argc > 1 ? Argv[1] : nullptr;
+    int32 NumRun = 0;
+    int32 NumFailed = 0;
+    for (const FTestCase& Test : GetTests())
+    {
+        if (Filter && !std::strstr(Test.Name, Filter))
+        {
+            continue;
+        }
+
+        const int32 FailuresBefore = NumFailures;
+        Test.Function();
+        ++NumRun;
+        const bool bPassed = NumFailures == FailuresBefore;
+        NumFailed += bPassed ? 0 : 1;
+        std::printf("[%s] %s\n", bPassed ? "PASS" : "FAIL", Test.Name);
+    }
+
+    std::printf("%d of %d tests passed\n", NumRun - NumFailed, NumRun);
+    return NumFailed == 0 && NumRun > 0 ? 0 : 1;
+}
+
+#endif
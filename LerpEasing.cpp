@@ -0,0 +1,106 @@
+#include "LerpEasing.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+
+namespace LerpEasing
+{
+    namespace
+    {
+        // 曲线自身的时间范围按比例对应到0~1
+        float GetSampleTime(const UCurveBase* Curve, int32 SampleIndex)
+        {
+            float MinTime = 0.0f;
+            float MaxTime = 1.0f;
+            Curve->GetTimeRange(MinTime, MaxTime);
+            if (MaxTime <= MinTime)
+            {
+                MinTime = 0.0f;
+                MaxTime = 1.0f;
+            }
+            return FMath::Lerp(MinTime, MaxTime, static_cast<float>(SampleIndex) / (FLerpCurveTables::NumSamples - 1));
+        }
+    }
+
+    int32 FLerpCurveTables::FindOrAddTable(const UCurveBase* Curve, int32 NumChannels, bool& bOutNeedsBake)
+    {
+        if (const int32* ExistingIndex = TableIndices.Find(Curve))
+        {
+            if (Sources[*ExistingIndex].Curve.Get() == Curve)
+            {
+                Samples.AddRef(*ExistingIndex);
+                bOutNeedsBake = false;
+                return *ExistingIndex;
+            }
+
+            // 旧资产已被回收，地址被新资产复用。旧表留给还在用它的tween，引用归零时释放
+            TableIndices.Remove(Curve);
+        }
+
+        const int32 TableIndex = Samples.Add(NumChannels);
+        if (Sources.Num() <= TableIndex)
+        {
+            Sources.SetNum(TableIndex + 1);
+        }
+        Sources[TableIndex].Key = Curve;
+        Sources[TableIndex].Curve = Curve;
+        TableIndices.Add(Curve, TableIndex);
+        bOutNeedsBake = true;
+        return TableIndex;
+    }
+
+    int32 FLerpCurveTables::AddFloatCurve(const UCurveFloat* Curve)
+    {
+        bool bNeedsBake;
+        const int32 TableIndex = FindOrAddTable(Curve, 1, bNeedsBake);
+        if (bNeedsBake)
+        {
+            float* TableSamples = Samples.GetSamples(TableIndex);
+            for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+            {
+                TableSamples[SampleIndex] = Curve->GetFloatValue(GetSampleTime(Curve, SampleIndex));
+            }
+        }
+        return TableIndex;
+    }
+
+    int32 FLerpCurveTables::AddVectorCurve(const UCurveVector* Curve)
+    {
+        bool bNeedsBake;
+        const int32 TableIndex = FindOrAddTable(Curve, 3, bNeedsBake);
+        if (bNeedsBake)
+        {
+            float* TableSamples = Samples.GetSamples(TableIndex);
+            for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+            {
+                const FVector Value = Curve->GetVectorValue(GetSampleTime(Curve, SampleIndex));
+                TableSamples[SampleIndex * 3 + 0] = static_cast<float>(Value.X);
+                TableSamples[SampleIndex * 3 + 1] = static_cast<float>(Value.Y);
+                TableSamples[SampleIndex * 3 + 2] = static_cast<float>(Value.Z);
+            }
+        }
+        return TableIndex;
+    }
+
+    void FLerpCurveTables::Release(int32 TableIndex)
+    {
+        if (!Samples.Release(TableIndex))
+        {
+            return;
+        }
+
+        // 只有登记表仍指向这张表时才移除登记，地址被复用的情况下登记已经指向新表
+        FTableSource& Source = Sources[TableIndex];
+        const int32* RegisteredIndex = TableIndices.Find(Source.Key);
+        if (RegisteredIndex && *RegisteredIndex == TableIndex)
+        {
+            TableIndices.Remove(Source.Key);
+        }
+        Source = FTableSource();
+    }
+
+    SIZE_T FLerpCurveTables::GetAllocatedSize() const
+    {
+        return Samples.GetAllocatedSize() + Sources.GetAllocatedSize() + TableIndices.GetAllocatedSize();
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LerpTypes.h"
+#include "LerpCore/LerpCoreEasing.h"
+
+class UCurveBase;
+class UCurveFloat;
+class UCurveVector;
+
+namespace LerpEasing
+{
+    // 曲线缓存：每个被引用的曲线资产按固定分辨率采样一次，所有用它的tween共用同一张表。
+    // 采样表本身放在LerpCore的FLerpSampleTables里，这里只负责资产到表的登记和烘焙。表按引用计数在最后一个tween结束时释放
+    class FLerpCurveTables
+    {
+    public:
+        static constexpr int32 NumSamples = FLerpSampleTables::NumSamples;
+
+        // 返回表的下标，每次Add都要对应一次Release
+        int32 AddFloatCurve(const UCurveFloat* Curve);
+        int32 AddVectorCurve(const UCurveVector* Curve);
+        void Release(int32 TableIndex);
+
+        // 推进时按下标查表
+        const FLerpSampleTables& GetSamples() const { return Samples; }
+
+        int32 Num() const { return Samples.Num(); }
+
+        // 所有表及索引占用的内存（字节）
+        SIZE_T GetAllocatedSize() const;
+
+    private:
+        // 表的来源资产，按表的下标存放
+        struct FTableSource
+        {
+            // 登记时的地址；资产被回收、地址被复用时靠弱指针识别出旧表
+            const UCurveBase* Key = nullptr;
+            TWeakObjectPtr<const UCurveBase> Curve;
+        };
+
+        // 已有同一资产的表时增加引用并返回，否则新建一张NumChannels个分量的空表
+        int32 FindOrAddTable(const UCurveBase* Curve, int32 NumChannels, bool& bOutNeedsBake);
+
+        FLerpSampleTables Samples;
+        TArray<FTableSource> Sources;
+        TMap<const UCurveBase*, int32> TableIndices;
+    };
+}
@@ -1,831 +1,655 @@
-#pragma once
-#include "LerpLibrary.h"
-#include "Kismet/BlueprintFunctionLibrary.h"
-
-
-#include "Engine/World.h"
-#include "Camera/CameraComponent.h"
-#include "TimerManager.h"
-
-void ULerpLibrary::MoveActorToLocation(AActor* Actor, FVector TargetLocation, float Duration)
-{
-    if (Actor == nullptr || Duration <= 0.0f)
-    {
-        return;
-    }
-    FVector StartLocation = Actor->GetActorLocation();
-    InitializeMove(Actor, Actor, StartLocation, TargetLocation, Duration);
-}
-
-void ULerpLibrary::RotateActorToRotation(AActor* Actor, FRotator TargetRotation, float Duration)
-{
-    if (Actor == nullptr || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    FRotator StartRotation = Actor->GetActorRotation();
-    InitializeRotate(Actor, Actor, StartRotation, TargetRotation, Duration);
-}
-
-void ULerpLibrary::ScaleActorToScale(AActor* Actor, FVector TargetScale, float Duration)
-{
-    if (Actor == nullptr || Duration <= 0.0f)
-    {
-        return;
-    }
-    FVector StartScale = Actor->GetActorScale3D();
-    InitializeScale(Actor, Actor, StartScale, TargetScale, Duration);
-}
-
-void ULerpLibrary::InitializeMove(UObject* WorldContextObject, AActor* Actor, FVector StartLocation, FVector TargetLocation, float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Actor = Actor;
-    LerpLibrary->StartLocation = StartLocation;
-    LerpLibrary->TargetLocation = TargetLocation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (Actor->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::MoveActor, 0.01f);
-        Actor->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::InitializeRotate(UObject* WorldContextObject, AActor* Actor, FRotator StartRotation, FRotator TargetRotation, float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Actor = Actor;
-    LerpLibrary->StartRotation = StartRotation;
-    LerpLibrary->TargetRotation = TargetRotation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (Actor->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::RotateActor, 0.01f);
-        Actor->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::InitializeScale(UObject* WorldContextObject, AActor* Actor, FVector StartScale, FVector TargetScale, float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Actor = Actor;
-    LerpLibrary->StartScale = StartScale;
-    LerpLibrary->TargetScale = TargetScale;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (Actor->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::ScaleActor, 0.01f);
-        Actor->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::MoveActor(float DeltaTime)
-{
-    if (!Actor)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    FVector NewLocation = FMath::Lerp(StartLocation, TargetLocation, Alpha);
-    Actor->SetActorLocation(NewLocation);
-
-    if (Alpha >= 1.0f)
-    {
-        if (Actor->GetWorld())
-        {
-            Actor->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-
-
-// Implementation of the static function to start lerp
-void ULerpLibrary::LerpFloatToTarget(UObject* WorldContextObject, float& CurrentValue, float TargetValue, float Duration)
-{
-    if (WorldContextObject == nullptr || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    // Create and initialize the lerp instance
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->ValuePtr = &CurrentValue;
-    LerpLibrary->TargetValue = TargetValue;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (WorldContextObject->GetWorld())
-    {
-        // Set up a timer to call LerpFloat regularly
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::LerpFloat, 0.01f);
-        WorldContextObject->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->LerpFloatTimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::RotateActor(float DeltaTime)
-{
-    if (!Actor)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    FRotator NewRotation = FMath::Lerp(StartRotation, TargetRotation, Alpha);
-    Actor->SetActorRotation(NewRotation);
-
-    if (Alpha >= 1.0f)
-    {
-        if (Actor->GetWorld())
-        {
-            Actor->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-void ULerpLibrary::ScaleActor(float DeltaTime)
-{
-    if (!Actor)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    FVector NewScale = FMath::Lerp(StartScale, TargetScale, Alpha);
-    Actor->SetActorScale3D(NewScale);
-
-    if (Alpha >= 1.0f)
-    {
-        if (Actor->GetWorld())
-        {
-            Actor->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-void ULerpLibrary::MoveComponentToLocation(USceneComponent* Component, FVector TargetLocation, float Duration)
-{
-    if (Component == nullptr || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    FVector StartLocation = Component->GetComponentLocation();
-    InitializeMoveComponent(Component->GetOwner(), Component, StartLocation, TargetLocation, Duration);
-}
-
-
-void ULerpLibrary::MoveComponentToDynamicLocation(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration)
-{
-    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    // ʼλ
-    FVector StartLocation = ComponentToMove->GetComponentLocation();
-    FVector TargetLocation = ParentComponent->GetSocketLocation(SocketName);
-
-    // ʼƶ߼
-    InitializeDynamicMoveComponent(
-        ParentComponent->GetOwner(),
-        ParentComponent,
-        ComponentToMove,
-        StartLocation,
-        TargetLocation,
-        SocketName,
-        Duration);
-}
-
-void ULerpLibrary::InitializeDynamicMoveComponent(
-    UObject* WorldContextObject,
-    USceneComponent* ParentComponent,
-    USceneComponent* ComponentToMove,
-    FVector StartLocation,
-    FVector TargetLocation,
-    FName SocketName,
-    float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Component = ComponentToMove;
-    LerpLibrary->ParentComponent = ParentComponent;
-    LerpLibrary->SocketName = SocketName;
-    LerpLibrary->StartLocation = StartLocation;
-    LerpLibrary->TargetLocation = TargetLocation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (ParentComponent->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::MoveComponentToDynamicLocationUpdate);
-        ParentComponent->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::MoveComponentToDynamicLocationUpdate()
-{
-    if (!Component || !ParentComponent)
-    {
-        return;
-    }
-
-    // Ŀλ
-    TargetLocation = ParentComponent->GetSocketLocation(SocketName);
-
-    // DeltaTimeͨTimer̶
-    float DeltaTime = 0.01f;
-
-    // ʱֵ
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    // ƽλ
-    FVector NewLocation = FMath::Lerp(StartLocation, TargetLocation, Alpha);
-    Component->SetWorldLocation(NewLocation);
-
-    // жǷ񵽴Ŀ
-    if (Alpha >= 1.0f || FVector::Dist(NewLocation, TargetLocation) <= KINDA_SMALL_NUMBER)
-    {
-        if (Component->GetWorld())
-        {
-            Component->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-
-
-
-void ULerpLibrary::RotateComponentToRotation(USceneComponent* Component, FRotator TargetRotation, float Duration)
-{
-    if (Component == nullptr || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    FRotator StartRotation = Component->GetComponentRotation();
-    InitializeRotateComponent(Component->GetOwner(), Component, StartRotation, TargetRotation, Duration);
-}
-
-void ULerpLibrary::RotateComponentToRelativeRotation(USceneComponent* Component, FRotator TargetRotation, float Duration)
-{
-    if (Component == nullptr || Duration <= 0.0f)
-    {
-        return;
-    }
-    InitializeRelativeRotateComponent(Component->GetOwner(), Component, TargetRotation, Duration);
-}
-
-void ULerpLibrary::InitializeMoveComponent(UObject* WorldContextObject, USceneComponent* Component, FVector StartLocation, FVector TargetLocation, float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Component = Component;
-    LerpLibrary->StartLocation = StartLocation;
-    LerpLibrary->TargetLocation = TargetLocation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (Component->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::MoveComponent, 0.01f);
-        Component->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::InitializeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator StartRotation, FRotator TargetRotation, float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Component = Component;
-    LerpLibrary->StartRotation = StartRotation;
-    LerpLibrary->TargetRotation = TargetRotation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (Component->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::RotateComponent, 0.01f);
-        Component->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.03f, true);
-    }
-}
-
-void ULerpLibrary::InitializeRelativeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator TargetRotation, float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Component = Component;
-    LerpLibrary->TargetRotation = TargetRotation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (Component->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::RotateComponentRelative, 0.01f);
-        Component->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.03f, true);
-    }
-
-}
-
-void ULerpLibrary::MoveComponent(float DeltaTime)
-{
-    if (!Component)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    FVector NewLocation = FMath::Lerp(StartLocation, TargetLocation, Alpha);
-    Component->SetWorldLocation(NewLocation);
-
-    if (Alpha >= 1.0f)
-    {
-        if (Component->GetWorld())
-        {
-            Component->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-void ULerpLibrary::RotateComponent(float DeltaTime)
-{
-    if (!Component)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    FRotator NewRotation = FMath::Lerp(StartRotation, TargetRotation, Alpha);
-    Component->SetWorldRotation(NewRotation);
-
-    if (Alpha >= 1.0f)
-    {
-        if (Component->GetWorld())
-        {
-            Component->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-void ULerpLibrary::RotateComponentRelative(float DeltaTime)
-{
-    if (!Component)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    FRotator CurrentRelativeRotation = Component->GetRelativeRotation();
-
-    FRotator NewRotation = FMath::Lerp(CurrentRelativeRotation, TargetRotation, Alpha);
-
-    Component->SetRelativeRotation(NewRotation);
-
-    if (Alpha >= 1.0f)
-    {
-        if (Component->GetWorld())
-        {
-            Component->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-// ԭеĺʵֲ
-
-// Implementation of the lerp function
-void ULerpLibrary::LerpFloat(float DeltaTime)
-{
-    if (!ValuePtr || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    // Perform the linear interpolation
-    *ValuePtr = FMath::Lerp(*ValuePtr, TargetValue, Alpha);
-
-    // If lerp is complete, stop the timer
-    if (Alpha >= 1.0f)
-    {
-        if (UWorld* World = GEngine->GetWorldFromContextObjectChecked(this))
-        {
-            World->GetTimerManager().ClearTimer(LerpFloatTimerHandle);
-        }
-    }
-}
-
-
-
-void ULerpLibrary::MoveComponentToSocketLocation(
-    USceneComponent* AComponent,
-    USceneComponent* BComponent,
-    FName SocketName,
-    float Duration)
-{
-    if (!AComponent || !BComponent || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    // ȡʼλúĿλ
-    FVector StartLocation = AComponent->GetComponentLocation();
-    FVector TargetLocation = BComponent->GetSocketLocation(SocketName);
-
-    // ʼ̬ƶ
-    InitializeMoveToSocket(AComponent->GetOwner(), AComponent, BComponent, StartLocation, TargetLocation, SocketName, Duration);
-}
-
-void ULerpLibrary::InitializeMoveToSocket(
-    UObject* WorldContextObject,
-    USceneComponent* AComponent,
-    USceneComponent* BComponent,
-    FVector StartLocation,
-    FVector TargetLocation,
-    FName SocketName,
-    float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->AComponent = AComponent;
-    LerpLibrary->BComponent = BComponent;
-    LerpLibrary->SocketName = SocketName;
-    LerpLibrary->StartLocation = StartLocation;
-    LerpLibrary->TargetLocation = TargetLocation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (AComponent->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::MoveComponentToSocketLocationUpdate);
-        AComponent->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::MoveComponentToSocketLocationUpdate()
-{
-    if (!AComponent || !BComponent)
-    {
-        return;
-    }
-
-    // Ŀλ
-    TargetLocation = BComponent->GetSocketLocation(SocketName);
-
-    // DeltaTime̶
-    float DeltaTime = 0.01f;
-
-    // ʱֵ
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    // ƽλ
-    FVector NewLocation = FMath::Lerp(StartLocation, TargetLocation, Alpha);
-    AComponent->SetWorldLocation(NewLocation);
-
-    // жǷ񵽴Ŀ
-    if (Alpha >= 1.0f || FVector::Dist(NewLocation, TargetLocation) <= KINDA_SMALL_NUMBER)
-    {
-        if (AComponent->GetWorld())
-        {
-            AComponent->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-
-
-void ULerpLibrary::ChangeCameraFOV(UCameraComponent* CameraComponent, float TargetFOV, float Duration)
-{
-    if (!CameraComponent || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    float CurrentFOV = CameraComponent->FieldOfView;
-
-    ULerpLibrary* LerpInstance = NewObject<ULerpLibrary>(CameraComponent->GetOwner());
-    LerpInstance->InitializeCameraFOVChange(CameraComponent->GetOwner(), CameraComponent, CurrentFOV, TargetFOV, Duration);
-}
-
-
-
-void ULerpLibrary::InitializeCameraFOVChange(UObject* WorldContextObject, UCameraComponent* CameraComponent, float InitialFOV, float TargetFOV, float Duration)
-{
-    if (!CameraComponent || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    // һ ULerpLibrary ʵ
-    ULerpLibrary* LerpInstance = NewObject<ULerpLibrary>(WorldContextObject);
-    if (!LerpInstance)
-    {
-        return;
-    }
-
-    // ʼʵ
-    LerpInstance->Camera = CameraComponent;
-    LerpInstance->StartFOV = InitialFOV;
-    LerpInstance->EndFOV = TargetFOV;
-    LerpInstance->Duration = Duration;
-    LerpInstance->ElapsedTime = 0.0f;
-
-    // ʱ
-    if (CameraComponent->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpInstance, &ULerpLibrary::UpdateCameraFOV, 0.01f);
-        CameraComponent->GetWorld()->GetTimerManager().SetTimer(LerpInstance->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-
-
-void ULerpLibrary::UpdateCameraFOV(float DeltaTime)
-{
-    if (!Camera)
-    {
-        return;
-    }
-
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    float NewFOV = FMath::Lerp(StartFOV, EndFOV, Alpha);
-    Camera->SetFieldOfView(NewFOV);
-
-    if (Alpha >= 1.0f)
-    {
-        if (Camera->GetWorld())
-        {
-            Camera->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-
-
-
-void ULerpLibrary::MoveComponentToDynamicLocationWithRotation(
-    USceneComponent* ParentComponent,
-    USceneComponent* ComponentToMove,
-    FName SocketName,
-    float Duration)
-{
-    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    InitializeDynamicMoveComponentWithRotation(
-        ParentComponent->GetOwner(),
-        ParentComponent,
-        ComponentToMove,
-        SocketName,
-        Duration);
-}
-
-void ULerpLibrary::InitializeDynamicMoveComponentWithRotation(
-    UObject* WorldContextObject,
-    USceneComponent* ParentComponent,
-    USceneComponent* ComponentToMove,
-    FName SocketName,
-    float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Component = ComponentToMove;
-    LerpLibrary->ParentComponent = ParentComponent;
-    LerpLibrary->SocketName = SocketName;
-    LerpLibrary->TargetLocation = ParentComponent->GetSocketLocation(SocketName);
-    LerpLibrary->TargetRotation_Quat = ParentComponent->GetSocketRotation(SocketName).Quaternion();
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (ParentComponent->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::MoveComponentToDynamicLocationWithRotationUpdate);
-        ParentComponent->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::MoveComponentToDynamicLocationWithRotationUpdate()
-{
-    if (!Component || !ParentComponent)
-    {
-        return;
-    }
-
-    // 0: ȡǰRelativeLocation
-    FVector CurrentRelativeLocation =Component->GetRelativeLocation();
-
-
-    // ȡ Socket ͸ת
-    FRotator CurrentRelativeRotation = Component->GetRelativeRotation();
-
-
-    // ʱֵ
-    float DeltaTime = 0.01f;
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-
-    //  Alpha  NewRelativeSocketLocation ת
-    // µλòֵ
-    FVector NewLocation = FMath::Lerp(CurrentRelativeLocation, FVector::ZeroVector, Alpha);
-    Component->SetRelativeLocation(NewLocation); // µλ
-
-    // µתֵʹԪֵ
-    FRotator NewRotation = FMath::Lerp(CurrentRelativeRotation, FRotator::ZeroRotator, Alpha); // ʹ Slerp ֵת
-
-    Component->SetRelativeRotation(NewRotation); // µת
-
-
-    // жǷ񵽴Ŀ
-    if (Alpha >= 1.0f ||
-        (FVector::Dist(NewLocation, TargetLocation) <= KINDA_SMALL_NUMBER &&  // Ŀλж
-            FQuat(NewRotation).AngularDistance(FQuat(TargetRotation)) <= KINDA_SMALL_NUMBER))  // Ŀתж
-    {
-        // ֹͣʱ
-        if (Component->GetWorld())
-        {
-            Component->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-
-void ULerpLibrary::MoveComponentToZeroWithLerp(
-    USceneComponent* ParentComponent,
-    USceneComponent* ComponentToMove,
-    float Duration)
-{
-    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
-    {
-        return;
-    }
-
-    // ʼAComponentToMoveλúתλúת
-    FVector StartLocation = ComponentToMove->GetComponentLocation();
-    FVector TargetLocation = FVector::ZeroVector;
-    FQuat StartRotation = ComponentToMove->GetComponentQuat();
-    FQuat TargetRotation = FQuat::Identity;
-
-    // ʼƶ߼
-    InitializeDynamicMoveComponentWithRotation(
-        ParentComponent->GetOwner(),
-        ParentComponent,
-        ComponentToMove,
-        Duration);
-}
-
-void ULerpLibrary::InitializeDynamicMoveComponentWithRotation(
-    UObject* WorldContextObject,
-    USceneComponent* ParentComponent,
-    USceneComponent* ComponentToMove,
-    float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Component = ComponentToMove;
-    LerpLibrary->ParentComponent = ParentComponent;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (ParentComponent->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::MoveComponentToZeroWithLerpUpdate);
-        ParentComponent->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-void ULerpLibrary::MoveComponentToZeroWithLerpUpdate()
-{
-    if (!Component || !ParentComponent)
-    {
-        return;
-    }
-
-    // Ŀλתλúת
-    TargetLocation = FVector::ZeroVector;
-    TargetRotation_Quat = FQuat::Identity;
-
-    // DeltaTimeͨTimer̶
-    float DeltaTime = 0.01f;
-
-    // ʱֵ
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    // ƽλ
-    FVector NewLocation = FMath::Lerp(StartLocation, TargetLocation, Alpha);
-    Component->SetRelativeLocation(NewLocation);
-
-    // ƽת
-    FQuat NewRotation = FQuat::Slerp(StartRotation_Quat, TargetRotation_Quat, Alpha);
-    Component->SetRelativeRotation(NewRotation);
-
-    // жǷ񵽴Ŀ
-    if (Alpha >= 1.0f || (FVector::Dist(NewLocation, TargetLocation) <= KINDA_SMALL_NUMBER &&
-        FQuat::ErrorAutoNormalize(TargetRotation_Quat, NewRotation) <= KINDA_SMALL_NUMBER))
-    {
-        if (Component->GetWorld())
-        {
-            Component->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
-
-
-
-void ULerpLibrary::MoveComponentRelativeToParent(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FVector TargetRelativeLocation, float Duration)
-{
-    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
-    {
-        return;
-    }
-
-
-    // ʼƽֵ
-    InitializeMoveComponentRelativeToParent(
-        ParentComponent->GetOwner(),
-        ParentComponent,
-        ComponentToMove,
-        TargetRelativeLocation,
-        Duration);
-}
-
-
-void ULerpLibrary::InitializeMoveComponentRelativeToParent(
-    UObject* WorldContextObject,
-    USceneComponent* ParentComponent,
-    USceneComponent* ComponentToMove,
-    FVector TargetRelativeLocation,
-    float Duration)
-{
-    ULerpLibrary* LerpLibrary = NewObject<ULerpLibrary>(WorldContextObject);
-    LerpLibrary->Component = ComponentToMove;
-    LerpLibrary->ParentComponent = ParentComponent;
-    LerpLibrary->TargetRelativeLocation = TargetRelativeLocation;
-    LerpLibrary->Duration = Duration;
-    LerpLibrary->ElapsedTime = 0.0f;
-
-    if (ParentComponent->GetWorld())
-    {
-        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(LerpLibrary, &ULerpLibrary::MoveComponentRelativeToParentUpdate);
-        ParentComponent->GetWorld()->GetTimerManager().SetTimer(LerpLibrary->TimerHandle, TimerDelegate, 0.01f, true);
-    }
-}
-
-
-void ULerpLibrary::MoveComponentRelativeToParentUpdate()
-{
-    if (!Component || !ParentComponent)
-    {
-        return;
-    }
-
-    // ȡλãҪʹ
-    FVector CurrentRelativeLocation = Component->GetRelativeLocation();
-
-
-    // ĿλãĿλԸ
-    FVector BRelativeLocation = this->TargetRelativeLocation;
-
-    // DeltaTime̶
-    float DeltaTime = 0.01f;
-
-    // ʱֵ
-    ElapsedTime += DeltaTime;
-    float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    // µλ
-    FVector NewRelativeLocation = FMath::Lerp(CurrentRelativeLocation, BRelativeLocation, Alpha);
-
-    // λ
-    Component->SetRelativeLocation(NewRelativeLocation);
-
-    // жǷ񵽴Ŀ
-    if (Alpha >= 1.0f || FVector::Dist(NewRelativeLocation, BRelativeLocation) <= KINDA_SMALL_NUMBER)
-    {
-        if (Component->GetWorld())
-        {
-            Component->GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-}
+#pragma once
+#include "LerpLibrary.h"
+#include "LerpSubsystem.h"
+
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Camera/CameraComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Curves/CurveFloat.h"
+
+bool ULerpLibrary::IsLerpActive(const UObject* WorldContextObject, FLerpHandle Handle)
+{
+    const ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    return LerpSubsystem && LerpSubsystem->IsTweenActive(Handle);
+}
+
+bool ULerpLibrary::CancelLerp(const UObject* WorldContextObject, FLerpHandle Handle)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    return LerpSubsystem && LerpSubsystem->CancelTween(Handle);
+}
+
+bool ULerpLibrary::PauseLerp(const UObject* WorldContextObject, FLerpHandle Handle)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    return LerpSubsystem && LerpSubsystem->PauseTween(Handle);
+}
+
+bool ULerpLibrary::ResumeLerp(const UObject* WorldContextObject, FLerpHandle Handle)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    return LerpSubsystem && LerpSubsystem->ResumeTween(Handle);
+}
+
+bool ULerpLibrary::FinishLerp(const UObject* WorldContextObject, FLerpHandle Handle)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    return LerpSubsystem && LerpSubsystem->FinishTween(Handle);
+}
+
+bool ULerpLibrary::IsLerpPaused(const UObject* WorldContextObject, FLerpHandle Handle)
+{
+    const ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    return LerpSubsystem && LerpSubsystem->IsTweenPaused(Handle);
+}
+
+void ULerpLibrary::SetLerpRelevance(const UObject* WorldContextObject, FLerpHandle Handle, ELerpRelevance Relevance)
+{
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        LerpSubsystem->SetTweenRelevance(Handle, Relevance);
+    }
+}
+
+void ULerpLibrary::SetLerpApplyTickGroup(const UObject* WorldContextObject, ETickingGroup TickGroup)
+{
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        LerpSubsystem->SetApplyTickGroup(TickGroup);
+    }
+}
+
+FLerpHandle ULerpLibrary::MoveActorToLocation(AActor* Actor, FVector TargetLocation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Actor == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+    FVector StartLocation = Actor->GetActorLocation();
+    return InitializeMove(Actor, Actor, StartLocation, TargetLocation, Duration, Conflict, Ease, EaseCurve);
+}
+
+TArray<FLerpHandle> ULerpLibrary::MoveActorsToLocations(UObject* WorldContextObject, const TArray<AActor*>& Actors, const TArray<FVector>& TargetLocations, const TArray<float>& Durations, const TArray<float>& Delays, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    TArray<FLerpHandle> Handles;
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    if (!LerpSubsystem)
+    {
+        Handles.SetNum(Actors.Num());
+        return Handles;
+    }
+
+    // Actor的位移即根组件的世界位移
+    TArray<USceneComponent*> Components;
+    Components.Reserve(Actors.Num());
+    for (AActor* Actor : Actors)
+    {
+        Components.Add(Actor ? Actor->GetRootComponent() : nullptr);
+    }
+
+    LerpSubsystem->AddVectorTweens(Components, ELerpVectorChannel::WorldLocation, TargetLocations, Durations, Delays, Conflict, FLerpEasing(Ease, EaseCurve), Handles);
+    return Handles;
+}
+
+TArray<FLerpHandle> ULerpLibrary::StaggerMoveActorsToLocations(UObject* WorldContextObject, const TArray<AActor*>& Actors, const TArray<FVector>& TargetLocations, const TArray<float>& Durations, const FLerpStagger& Stagger, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    return MoveActorsToLocations(WorldContextObject, Actors, TargetLocations, Durations, GetStaggerDelays(Stagger, Actors.Num()), Conflict, Ease, EaseCurve);
+}
+
+TArray<float> ULerpLibrary::GetStaggerDelays(const FLerpStagger& Stagger, int32 Num)
+{
+    TArray<float> Delays;
+    if (Num <= 0)
+    {
+        return Delays;
+    }
+
+    Delays.SetNumUninitialized(Num);
+    const int32 Columns = FMath::Max(Stagger.GridColumns, 1);
+    const int32 Origin = FMath::Clamp(Stagger.Origin, 0, Num - 1);
+    float MaxDelay = 0.0f;
+    for (int32 Element = 0; Element < Num; ++Element)
+    {
+        float Delay = 0.0f;
+        switch (Stagger.Mode)
+        {
+        case ELerpStaggerMode::Linear:
+            Delay = Stagger.Interval * Element;
+            break;
+        case ELerpStaggerMode::Grid:
+        {
+            const float Dx = static_cast<float>(Element % Columns - Origin % Columns);
+            const float Dy = static_cast<float>(Element / Columns - Origin / Columns);
+            Delay = Stagger.Interval * FMath::Sqrt(Dx * Dx + Dy * Dy);
+            break;
+        }
+        case ELerpStaggerMode::Radial:
+            Delay = Stagger.Interval * FMath::Abs(Element - Origin);
+            break;
+        case ELerpStaggerMode::Curve:
+            Delay = Stagger.Curve ? Stagger.Curve->GetFloatValue(Num > 1 ? static_cast<float>(Element) / (Num - 1) : 0.0f) : 0.0f;
+            break;
+        }
+        Delays[Element] = FMath::Max(Delay, 0.0f);
+        MaxDelay = FMath::Max(MaxDelay, Delays[Element]);
+    }
+
+    for (float& Delay : Delays)
+    {
+        Delay = (Stagger.bReverse ? MaxDelay - Delay : Delay) + FMath::Max(Stagger.StartDelay, 0.0f);
+    }
+    return Delays;
+}
+
+FLerpHandle ULerpLibrary::RotateActorToRotation(AActor* Actor, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Actor == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    FRotator StartRotation = Actor->GetActorRotation();
+    return InitializeRotate(Actor, Actor, StartRotation, TargetRotation, Duration, Conflict, Ease, EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::ScaleActorToScale(AActor* Actor, FVector TargetScale, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Actor == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+    FVector StartScale = Actor->GetActorScale3D();
+    return InitializeScale(Actor, Actor, StartScale, TargetScale, Duration, Conflict, Ease, EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::InitializeMove(UObject* WorldContextObject, AActor* Actor, FVector StartLocation, FVector TargetLocation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    // Actor的位移即根组件的世界位移
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    if (LerpSubsystem && Actor->GetRootComponent())
+    {
+        return LerpSubsystem->AddVectorTween(Actor->GetRootComponent(), ELerpVectorChannel::WorldLocation, StartLocation, TargetLocation, Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::InitializeRotate(UObject* WorldContextObject, AActor* Actor, FRotator StartRotation, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    if (LerpSubsystem && Actor->GetRootComponent())
+    {
+        return LerpSubsystem->AddQuatTween(Actor->GetRootComponent(), ELerpRotationChannel::World, StartRotation.Quaternion(), TargetRotation.Quaternion(), Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::InitializeScale(UObject* WorldContextObject, AActor* Actor, FVector StartScale, FVector TargetScale, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    if (LerpSubsystem && Actor->GetRootComponent())
+    {
+        return LerpSubsystem->AddVectorTween(Actor->GetRootComponent(), ELerpVectorChannel::WorldScale, StartScale, TargetScale, Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+// Implementation of the static function to start lerp
+FLerpHandle ULerpLibrary::LerpFloatToTarget(UObject* WorldContextObject, float& CurrentValue, float TargetValue, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (WorldContextObject == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    // 只接受WorldContextObject自身的成员：局部变量和蓝图的临时变量在返回后就失效了，之后每步写入都是野指针
+    const UPTRINT ObjectBegin = reinterpret_cast<UPTRINT>(WorldContextObject);
+    const UPTRINT ObjectEnd = ObjectBegin + WorldContextObject->GetClass()->GetStructureSize();
+    const UPTRINT ValueAddress = reinterpret_cast<UPTRINT>(&CurrentValue);
+    if (ValueAddress < ObjectBegin || ValueAddress + sizeof(float) > ObjectEnd)
+    {
+        return FLerpHandle();
+    }
+
+    // Hand the value to the subsystem, which lerps it every step
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddFloatTween(WorldContextObject, &CurrentValue, TargetValue, Duration, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::LerpFloatProperty(UObject* Target, FString PropertyPath, float TargetValue, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Target == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(Target))
+    {
+        return LerpSubsystem->AddPropertyTween(Target, PropertyPath, TargetValue, Duration, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::LerpFloatWithSetter(UObject* WorldContextObject, float StartValue, float TargetValue, float Duration, const FLerpFloatSetter& Setter, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (!Setter.IsBound() || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddSetterTween(Setter, StartValue, TargetValue, Duration, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::LerpMaterialScalarParameter(UObject* WorldContextObject, UMaterialInstanceDynamic* Material, FName ParameterName, float TargetValue, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Material == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    if (!LerpSubsystem)
+    {
+        return FLerpHandle();
+    }
+
+    // 材质随Owner回收，lambda被调用时它一定还活着。同一(材质, 参数)作为一个通道
+    const float StartValue = Material->K2_GetScalarParameterValue(ParameterName);
+    const FLerpHandle Handle = LerpSubsystem->AddCallbackTween(Material, ParameterName, StartValue, TargetValue, Duration, [Material, ParameterName](float Value)
+    {
+        Material->SetScalarParameterValue(ParameterName, Value);
+    }, Conflict, FLerpEasing(Ease, EaseCurve));
+
+    // 服务器上没人看得到材质
+    LerpSubsystem->SetTweenRelevance(Handle, ELerpRelevance::Cosmetic);
+    return Handle;
+}
+
+FLerpHandle ULerpLibrary::MoveComponentToLocation(USceneComponent* Component, FVector TargetLocation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Component == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    FVector StartLocation = Component->GetComponentLocation();
+    return InitializeMoveComponent(Component->GetOwner(), Component, StartLocation, TargetLocation, Duration, Conflict, Ease, EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::MoveComponentToLocationWithVectorCurve(USceneComponent* Component, FVector TargetLocation, float Duration, UCurveVector* Curve, ELerpConflict Conflict)
+{
+    if (Component == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(Component))
+    {
+        return LerpSubsystem->AddVectorTween(Component, ELerpVectorChannel::WorldLocation, Component->GetComponentLocation(), TargetLocation, Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Curve));
+    }
+
+    return FLerpHandle();
+}
+
+
+FLerpHandle ULerpLibrary::SpringComponentToLocation(USceneComponent* Component, FVector TargetLocation, float SmoothTime, ELerpConflict Conflict)
+{
+    if (Component == nullptr)
+    {
+        return FLerpHandle();
+    }
+
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(Component))
+    {
+        return LerpSubsystem->AddSpringTween(Component, ELerpVectorChannel::WorldLocation, TargetLocation, SmoothTime, Conflict);
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::SpringComponentToSocket(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float SmoothTime, ELerpConflict Conflict)
+{
+    if (ParentComponent == nullptr || ComponentToMove == nullptr)
+    {
+        return FLerpHandle();
+    }
+
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(ComponentToMove))
+    {
+        return LerpSubsystem->AddSpringFollowTween(ComponentToMove, ParentComponent, SocketName, SmoothTime, Conflict);
+    }
+
+    return FLerpHandle();
+}
+
+bool ULerpLibrary::SetSpringTarget(const UObject* WorldContextObject, FLerpHandle Handle, FVector TargetLocation)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    return LerpSubsystem && LerpSubsystem->SetSpringTarget(Handle, TargetLocation);
+}
+
+FLerpHandle ULerpLibrary::MoveComponentToDynamicLocation(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    // 初始化位置
+    FVector StartLocation = ComponentToMove->GetComponentLocation();
+    FVector TargetLocation = ParentComponent->GetSocketLocation(SocketName);
+
+    // 初始化移动逻辑
+    return InitializeDynamicMoveComponent(
+        ParentComponent->GetOwner(),
+        ParentComponent,
+        ComponentToMove,
+        StartLocation,
+        TargetLocation,
+        SocketName,
+        Duration,
+        Conflict,
+        Ease,
+        EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::InitializeDynamicMoveComponent(
+    UObject* WorldContextObject,
+    USceneComponent* ParentComponent,
+    USceneComponent* ComponentToMove,
+    FVector StartLocation,
+    FVector TargetLocation,
+    FName SocketName,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    // 目标位置每步由Socket重新计算，这里的TargetLocation只作初始参考
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddFollowTween(ComponentToMove, ParentComponent, SocketName, StartLocation, Duration, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::RotateComponentToRotation(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Component == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    FRotator StartRotation = Component->GetComponentRotation();
+    return InitializeRotateComponent(Component->GetOwner(), Component, StartRotation, TargetRotation, Duration, Conflict, Ease, EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::RotateComponentToRelativeRotation(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (Component == nullptr || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+    return InitializeRelativeRotateComponent(Component->GetOwner(), Component, TargetRotation, Duration, Conflict, Ease, EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::InitializeMoveComponent(UObject* WorldContextObject, USceneComponent* Component, FVector StartLocation, FVector TargetLocation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddVectorTween(Component, ELerpVectorChannel::WorldLocation, StartLocation, TargetLocation, Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::InitializeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator StartRotation, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddQuatTween(Component, ELerpRotationChannel::World, StartRotation.Quaternion(), TargetRotation.Quaternion(), Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::InitializeRelativeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    // 每步从当前相对旋转出发
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddQuatTween(Component, ELerpRotationChannel::Relative, Component->GetRelativeRotation().Quaternion(), TargetRotation.Quaternion(), Duration, ELerpTweenFlags::FromCurrent, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::MoveComponentToSocketLocation(
+    USceneComponent* AComponent,
+    USceneComponent* BComponent,
+    FName SocketName,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    if (!AComponent || !BComponent || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    // 获取初始位置和目标位置
+    FVector StartLocation = AComponent->GetComponentLocation();
+    FVector TargetLocation = BComponent->GetSocketLocation(SocketName);
+
+    // 初始化动态移动
+    return InitializeMoveToSocket(AComponent->GetOwner(), AComponent, BComponent, StartLocation, TargetLocation, SocketName, Duration, Conflict, Ease, EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::InitializeMoveToSocket(
+    UObject* WorldContextObject,
+    USceneComponent* AComponent,
+    USceneComponent* BComponent,
+    FVector StartLocation,
+    FVector TargetLocation,
+    FName SocketName,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddFollowTween(AComponent, BComponent, SocketName, StartLocation, Duration, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+FLerpHandle ULerpLibrary::ChangeCameraFOV(UCameraComponent* CameraComponent, float TargetFOV, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (!CameraComponent || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    float CurrentFOV = CameraComponent->FieldOfView;
+    return InitializeCameraFOVChange(CameraComponent->GetOwner(), CameraComponent, CurrentFOV, TargetFOV, Duration, Conflict, Ease, EaseCurve);
+}
+
+
+
+FLerpHandle ULerpLibrary::InitializeCameraFOVChange(UObject* WorldContextObject, UCameraComponent* CameraComponent, float InitialFOV, float TargetFOV, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (!CameraComponent || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    // 交给Lerp子系统统一更新
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddCameraFOVTween(CameraComponent, InitialFOV, TargetFOV, Duration, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+
+
+FLerpHandle ULerpLibrary::MoveComponentToDynamicLocationWithRotation(
+    USceneComponent* ParentComponent,
+    USceneComponent* ComponentToMove,
+    FName SocketName,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    return InitializeDynamicMoveComponentWithRotation(
+        ParentComponent->GetOwner(),
+        ParentComponent,
+        ComponentToMove,
+        SocketName,
+        Duration,
+        Conflict,
+        Ease,
+        EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::InitializeDynamicMoveComponentWithRotation(
+    UObject* WorldContextObject,
+    USceneComponent* ParentComponent,
+    USceneComponent* ComponentToMove,
+    FName SocketName,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    if (!LerpSubsystem)
+    {
+        return FLerpHandle();
+    }
+
+    // 相对位置和相对旋转都从当前值向零插值
+    // 返回位置tween的句柄，旋转tween与其同时开始、同时结束
+    const FLerpHandle Handle = LerpSubsystem->AddVectorTween(ComponentToMove, ELerpVectorChannel::RelativeLocation, ComponentToMove->GetRelativeLocation(), FVector::ZeroVector, Duration, ELerpTweenFlags::FromCurrent, Conflict, FLerpEasing(Ease, EaseCurve));
+    LerpSubsystem->AddQuatTween(ComponentToMove, ELerpRotationChannel::Relative, ComponentToMove->GetRelativeRotation().Quaternion(), FQuat::Identity, Duration, ELerpTweenFlags::FromCurrent, Conflict, FLerpEasing(Ease, EaseCurve));
+    return Handle;
+}
+
+FLerpHandle ULerpLibrary::MoveComponentToZeroWithLerp(
+    USceneComponent* ParentComponent,
+    USceneComponent* ComponentToMove,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+    // 初始化A组件（ComponentToMove）的位置和旋转（零位置和零旋转）
+    FVector StartLocation = ComponentToMove->GetComponentLocation();
+    FVector TargetLocation = FVector::ZeroVector;
+    FQuat StartRotation = ComponentToMove->GetComponentQuat();
+    FQuat TargetRotation = FQuat::Identity;
+
+    // 初始化移动逻辑
+    return InitializeDynamicMoveComponentWithRotation(
+        ParentComponent->GetOwner(),
+        ParentComponent,
+        ComponentToMove,
+        Duration,
+        Conflict,
+        Ease,
+        EaseCurve);
+}
+
+FLerpHandle ULerpLibrary::InitializeDynamicMoveComponentWithRotation(
+    UObject* WorldContextObject,
+    USceneComponent* ParentComponent,
+    USceneComponent* ComponentToMove,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject);
+    if (!LerpSubsystem)
+    {
+        return FLerpHandle();
+    }
+
+    // 从当前相对位置/旋转出发，位置线性插值、旋转Slerp到零
+    // 返回位置tween的句柄，旋转tween与其同时开始、同时结束
+    const FLerpHandle Handle = LerpSubsystem->AddVectorTween(ComponentToMove, ELerpVectorChannel::RelativeLocation, ComponentToMove->GetRelativeLocation(), FVector::ZeroVector, Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Ease, EaseCurve));
+    LerpSubsystem->AddQuatTween(ComponentToMove, ELerpRotationChannel::Relative, ComponentToMove->GetRelativeRotation().Quaternion(), FQuat::Identity, Duration, ELerpTweenFlags::None, Conflict, FLerpEasing(Ease, EaseCurve));
+    return Handle;
+}
+
+FLerpHandle ULerpLibrary::MoveComponentRelativeToParent(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FVector TargetRelativeLocation, float Duration, ELerpConflict Conflict, ELerpEase Ease, UCurveFloat* EaseCurve)
+{
+    if (!ParentComponent || !ComponentToMove || Duration <= 0.0f)
+    {
+        return FLerpHandle();
+    }
+
+
+    // 初始化平滑插值
+    return InitializeMoveComponentRelativeToParent(
+        ParentComponent->GetOwner(),
+        ParentComponent,
+        ComponentToMove,
+        TargetRelativeLocation,
+        Duration,
+        Conflict,
+        Ease,
+        EaseCurve);
+}
+
+
+FLerpHandle ULerpLibrary::InitializeMoveComponentRelativeToParent(
+    UObject* WorldContextObject,
+    USceneComponent* ParentComponent,
+    USceneComponent* ComponentToMove,
+    FVector TargetRelativeLocation,
+    float Duration,
+    ELerpConflict Conflict,
+    ELerpEase Ease,
+    UCurveFloat* EaseCurve)
+{
+    // 每步从组件当前的相对位置出发
+    if (ULerpSubsystem* LerpSubsystem = ULerpSubsystem::Get(WorldContextObject))
+    {
+        return LerpSubsystem->AddVectorTween(ComponentToMove, ELerpVectorChannel::RelativeLocation, ComponentToMove->GetRelativeLocation(), TargetRelativeLocation, Duration, ELerpTweenFlags::FromCurrent, Conflict, FLerpEasing(Ease, EaseCurve));
+    }
+
+    return FLerpHandle();
+}
+
+
@@ -1,182 +1,198 @@
-#pragma once
-
-#include "CoreMinimal.h"
-#include "UObject/NoExportTypes.h"
-#include "LerpLibrary.generated.h"
-
-UCLASS()
-class LUXUN2024_API ULerpLibrary : public UObject
-{
-    GENERATED_BODY()
-
-public:
-    // ֵƶλ
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void MoveActorToLocation(AActor* Actor, FVector TargetLocation, float Duration);
-
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void MoveComponentToLocation(USceneComponent* Component, FVector TargetLocation, float Duration);
-
-   
-
-    // ֵת
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void RotateActorToRotation(AActor* Actor, FRotator TargetRotation, float Duration);
-
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void RotateComponentToRotation(USceneComponent* Component, FRotator TargetRotation, float Duration);
-
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void RotateComponentToRelativeRotation(USceneComponent* Component, FRotator TargetRotation, float Duration);
-
-
-    // ֵ
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void ScaleActorToScale(AActor* Actor, FVector TargetScale, float Duration);
-
-
-    //floatֵlerp
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static  void LerpFloatToTarget(UObject* WorldContextObject, float& CurrentValue, float TargetValue, float Duration);
-
-
-    //MoveComponentToRelativeLocation
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void MoveComponentToDynamicLocation(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration);
-
-    static void InitializeDynamicMoveComponent(UObject* WorldContextObject, USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FVector StartLocation, FVector TargetLocation, FName SocketName, float Duration);
-
-    void MoveComponentToDynamicLocationUpdate();
-
-
-
-    //AComponentλƵBComponentSocketλã̬
-    UFUNCTION(BlueprintCallable, Category = "Lerp")
-    static void MoveComponentToSocketLocation(USceneComponent* AComponent, USceneComponent* BComponent, FName SocketName, float Duration);    
-
-    static void InitializeMoveToSocket(UObject* WorldContextObject, USceneComponent* AComponent, USceneComponent* BComponent, FVector StartLocation, FVector TargetLocation, FName SocketName, float Duration);
-
-    void MoveComponentToSocketLocationUpdate();
-
-
-
-    //CameraFOV
-    static void ChangeCameraFOV(class UCameraComponent* CameraComponent, float TargetFOV, float Duration);
-
-    static void InitializeCameraFOVChange(UObject* WorldContextObject, class UCameraComponent* CameraComponent, float InitialFOV, float TargetFOV, float Duration);
-
-    void UpdateCameraFOV(float DeltaTime);
-
-
-    //RotationmovecomponentĿλ
-    static void MoveComponentToDynamicLocationWithRotation(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration);
-
-    static  void InitializeDynamicMoveComponentWithRotation(UObject* WorldContextObject, USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration);
-
-    void MoveComponentToDynamicLocationWithRotationUpdate();
-
-    //Componentڸlerp
-    UFUNCTION(BlueprintCallable)
-    static void MoveComponentToZeroWithLerp(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, float Duration);
-
-    static void InitializeDynamicMoveComponentWithRotation(UObject* WorldContextObject, USceneComponent* ParentComponent, USceneComponent* ComponentToMove,float Duration);
-
-    void MoveComponentToZeroWithLerpUpdate();
-
-
-    //Ӽڸlocationlerp
-    static void MoveComponentRelativeToParent(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FVector TargetRelativeLocation, float Duration);
-
-    static void InitializeMoveComponentRelativeToParent(
-        UObject* WorldContextObject,
-        USceneComponent* ParentComponent,
-        USceneComponent* ComponentToMove,
-        FVector TargetrelativeLocation,
-        float Duration);
-
-    void MoveComponentRelativeToParentUpdate();
-
-
-
-    //ıFOV
-   // void ChangeCameraFOV(UCameraComponent* CameraComponent, float TargetFOV, float Duration);
-
-  //  void UpdateCameraFOV(float DeltaTime);
-
-
-
-private:
-    // ڳʼƶ
-    static void InitializeMove(UObject* WorldContextObject, AActor* Actor, FVector StartLocation, FVector TargetLocation, float Duration);
-
-    static void InitializeMoveComponent(UObject* WorldContextObject, USceneComponent* Component, FVector StartLocation, FVector TargetLocation, float Duration);
-
-    // ڳʼת
-    static void InitializeRotate(UObject* WorldContextObject, AActor* Actor, FRotator StartRotation, FRotator TargetRotation, float Duration);
-
-    static void InitializeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator StartRotation, FRotator TargetRotation, float Duration);
-
-    static void InitializeRelativeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator TargetRotation, float Duration);
-
-    // ڳʼ
-    static void InitializeScale(UObject* WorldContextObject, AActor* Actor, FVector StartScale, FVector TargetScale, float Duration);
-
-    // ƶ߼
-    void MoveActor(float DeltaTime);
-    void MoveComponent(float DeltaTime);
-
-
-
-    // ת߼
-    void RotateActor(float DeltaTime);
-    void RotateComponent(float DeltaTime);
-
-    void RotateComponentRelative(float DeltaTime);
-
-    // ߼
-    void ScaleActor(float DeltaTime);
-
-    // Բֵfloat
-    void LerpFloat(float DeltaTime);
-
-
-    
-
-
-
-    FVector StartRelativeLocation;
-    FVector TargetRelativeLocation;
-
-
-    AActor* Actor;
-    USceneComponent* Component;
-    USceneComponent* AComponent;
-    USceneComponent* BComponent;
-    USceneComponent* ParentComponent;
-    FName SocketName;
-    FVector StartLocation;
-    FVector TargetLocation;
-    FRotator StartRotation;
-    FRotator TargetRotation;
-    FQuat StartRotation_Quat;
-    FQuat TargetRotation_Quat;
-    FVector StartScale;
-    FVector TargetScale;
-    float Duration;
-    float ElapsedTime;
-    FTimerHandle TimerHandle;
-
-    class UCameraComponent* Camera;
-    float StartFOV;
-    float EndFOV;
-
-
-    // Timer handle for the lerping process
-    FTimerHandle LerpFloatTimerHandle;
-
-    // Variables for lerping
-    float* ValuePtr;
-    float TargetValue;
-
-
-};
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/EngineBaseTypes.h"
+#include "LerpTypes.h"
+#include "LerpLibrary.generated.h"
+
+class UMaterialInstanceDynamic;
+class UCurveFloat;
+class UCurveVector;
+
+UCLASS()
+class LUXUN2024_API ULerpLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    // 所有启动函数都返回FLerpHandle，可用来查询该lerp是否还在进行
+    UFUNCTION(BlueprintPure, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static bool IsLerpActive(const UObject* WorldContextObject, FLerpHandle Handle);
+
+    // 立即停止，不写入终点。排在其后的同属性lerp随即开始
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static bool CancelLerp(const UObject* WorldContextObject, FLerpHandle Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static bool PauseLerp(const UObject* WorldContextObject, FLerpHandle Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static bool ResumeLerp(const UObject* WorldContextObject, FLerpHandle Handle);
+
+    // 下一帧直接写入终点并结束
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static bool FinishLerp(const UObject* WorldContextObject, FLerpHandle Handle);
+
+    UFUNCTION(BlueprintPure, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static bool IsLerpPaused(const UObject* WorldContextObject, FLerpHandle Handle);
+
+    // 标记lerp是否只影响表现。专用服务器和无法渲染的进程里表现类lerp直接完成（或按Lerp.HeadlessCosmetic丢弃）。
+    // 相机FOV和材质参数默认已是表现类，其余默认照常推进
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static void SetLerpRelevance(const UObject* WorldContextObject, FLerpHandle Handle, ELerpRelevance Relevance);
+
+    // Lerp.AsyncEvaluation开启时，后台求值的结果在这个TickGroup写回组件，对该World的所有lerp生效。默认TG_PostUpdateWork
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static void SetLerpApplyTickGroup(const UObject* WorldContextObject, ETickingGroup TickGroup = TG_PostUpdateWork);
+
+    // 以下启动函数的Conflict决定同一目标的同一属性已有lerp时的处理方式，默认取消旧的；
+    // Ease选择缓动曲线，给了EaseCurve时改用该曲线（横轴为曲线自身的时间范围，按比例对应整个时长）
+    // 需要在完成或取消时继续执行的，用ULerpAsyncAction中对应的异步节点
+
+    // 插值移动位置
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle MoveActorToLocation(AActor* Actor, FVector TargetLocation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    // 一次启动一批Actor的位移，TargetLocations与Actors一一对应；Durations、Delays只给一个元素时全部共用，Delays可留空。
+    // 存储只预留一次，适合阵型、碎片等成千上万个同时开始的lerp。Delays大于0的延迟期间不动目标，起点在开始移动时读取。
+    // 返回的句柄与Actors一一对应，无效的Actor对应无效句柄
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "Delays"))
+    static TArray<FLerpHandle> MoveActorsToLocations(UObject* WorldContextObject, const TArray<AActor*>& Actors, const TArray<FVector>& TargetLocations, const TArray<float>& Durations, const TArray<float>& Delays, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    // 按Stagger错开各元素的开始时间，整组只做一次批量启动，其余同MoveActorsToLocations
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static TArray<FLerpHandle> StaggerMoveActorsToLocations(UObject* WorldContextObject, const TArray<AActor*>& Actors, const TArray<FVector>& TargetLocations, const TArray<float>& Durations, const FLerpStagger& Stagger, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    // 一组Num个元素按Stagger得到的启动延迟（秒），可作为其他批量启动的Delays
+    UFUNCTION(BlueprintPure, Category = "Lerp")
+    static TArray<float> GetStaggerDelays(const FLerpStagger& Stagger, int32 Num);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle MoveComponentToLocation(USceneComponent* Component, FVector TargetLocation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    // XYZ各轴按曲线对应分量缓动，曲线取值0~1对应起点到终点
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle MoveComponentToLocationWithVectorCurve(USceneComponent* Component, FVector TargetLocation, float Duration, UCurveVector* Curve, ELerpConflict Conflict = ELerpConflict::Replace);
+
+   
+
+    // 插值旋转
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle RotateActorToRotation(AActor* Actor, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle RotateComponentToRotation(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle RotateComponentToRelativeRotation(USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+    // 插值缩放
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle ScaleActorToScale(AActor* Actor, FVector TargetScale, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+    //float值的线性lerp。CurrentValue须是WorldContextObject自身的成员，不是时返回无效句柄；对象销毁后该lerp随之回收。
+    //蓝图里的引用参数是虚拟机的临时变量，写不回成员，蓝图请改用LerpFloatProperty或LerpFloatWithSetter
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (DeprecatedFunction, DeprecationMessage = "CurrentValue is a temporary in Blueprint and is never written back. Use LerpFloatProperty or LerpFloatWithSetter instead."))
+    static FLerpHandle LerpFloatToTarget(UObject* WorldContextObject, float& CurrentValue, float TargetValue, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    //按属性名lerp任意UObject上的float属性，可用"结构体.成员"的路径。起点只在开始时读取一次
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle LerpFloatProperty(UObject* Target, FString PropertyPath, float TargetValue, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    //每步把插值结果交给Setter，适合音量等需要调用函数才能生效的值。Setter绑定的对象销毁后自动停止
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static FLerpHandle LerpFloatWithSetter(UObject* WorldContextObject, float StartValue, float TargetValue, float Duration, const FLerpFloatSetter& Setter, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    //动态材质实例的标量参数，同一(材质, 参数)上的lerp按Conflict处理
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static FLerpHandle LerpMaterialScalarParameter(UObject* WorldContextObject, UMaterialInstanceDynamic* Material, FName ParameterName, float TargetValue, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+    // 临界阻尼弹簧：带着速度平滑追向目标，任意帧率下轨迹相同，停稳后结束。SmoothTime约为追上目标所需的时间。
+    // 默认Blend：再次调用只改目标，速度保持连续，适合每帧更新目标的镜头、武器跟随
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle SpringComponentToLocation(USceneComponent* Component, FVector TargetLocation, float SmoothTime, ELerpConflict Conflict = ELerpConflict::Blend);
+
+    // 弹簧跟随ParentComponent的Socket，直到取消或任一组件被销毁
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle SpringComponentToSocket(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float SmoothTime, ELerpConflict Conflict = ELerpConflict::Blend);
+
+    // 改变弹簧的目标，速度保持连续
+    UFUNCTION(BlueprintCallable, Category = "Lerp", meta = (WorldContext = "WorldContextObject"))
+    static bool SetSpringTarget(const UObject* WorldContextObject, FLerpHandle Handle, FVector TargetLocation);
+
+    //MoveComponentToRelativeLocation
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle MoveComponentToDynamicLocation(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeDynamicMoveComponent(UObject* WorldContextObject, USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FVector StartLocation, FVector TargetLocation, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+    //把AComponent给位移到BComponent的Socket位置，动态更新
+    UFUNCTION(BlueprintCallable, Category = "Lerp")
+    static FLerpHandle MoveComponentToSocketLocation(USceneComponent* AComponent, USceneComponent* BComponent, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);    
+
+    static FLerpHandle InitializeMoveToSocket(UObject* WorldContextObject, USceneComponent* AComponent, USceneComponent* BComponent, FVector StartLocation, FVector TargetLocation, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+    //更改CameraFOV
+    static FLerpHandle ChangeCameraFOV(class UCameraComponent* CameraComponent, float TargetFOV, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeCameraFOVChange(UObject* WorldContextObject, class UCameraComponent* CameraComponent, float InitialFOV, float TargetFOV, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+
+    //带有Rotation的movecomponent到目的位置
+    static FLerpHandle MoveComponentToDynamicLocationWithRotation(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeDynamicMoveComponentWithRotation(UObject* WorldContextObject, USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FName SocketName, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+    //把Component在父组件中lerp归零
+    UFUNCTION(BlueprintCallable)
+    static FLerpHandle MoveComponentToZeroWithLerp(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeDynamicMoveComponentWithRotation(UObject* WorldContextObject, USceneComponent* ParentComponent, USceneComponent* ComponentToMove,float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+
+
+    //子级相较于父级的location的lerp设置
+    static FLerpHandle MoveComponentRelativeToParent(USceneComponent* ParentComponent, USceneComponent* ComponentToMove, FVector TargetRelativeLocation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeMoveComponentRelativeToParent(
+        UObject* WorldContextObject,
+        USceneComponent* ParentComponent,
+        USceneComponent* ComponentToMove,
+        FVector TargetrelativeLocation,
+        float Duration,
+        ELerpConflict Conflict = ELerpConflict::Replace,
+        ELerpEase Ease = ELerpEase::Linear,
+        UCurveFloat* EaseCurve = nullptr);
+
+
+    //改变摄像机FOV
+   // void ChangeCameraFOV(UCameraComponent* CameraComponent, float TargetFOV, float Duration);
+
+  //  void UpdateCameraFOV(float DeltaTime);
+
+
+
+private:
+    // 辅助函数，用于初始化移动
+    static FLerpHandle InitializeMove(UObject* WorldContextObject, AActor* Actor, FVector StartLocation, FVector TargetLocation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeMoveComponent(UObject* WorldContextObject, USceneComponent* Component, FVector StartLocation, FVector TargetLocation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    // 辅助函数，用于初始化旋转
+    static FLerpHandle InitializeRotate(UObject* WorldContextObject, AActor* Actor, FRotator StartRotation, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator StartRotation, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    static FLerpHandle InitializeRelativeRotateComponent(UObject* WorldContextObject, USceneComponent* Component, FRotator TargetRotation, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+
+    // 辅助函数，用于初始化缩放
+    static FLerpHandle InitializeScale(UObject* WorldContextObject, AActor* Actor, FVector StartScale, FVector TargetScale, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, ELerpEase Ease = ELerpEase::Linear, UCurveFloat* EaseCurve = nullptr);
+};
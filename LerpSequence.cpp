@@ -0,0 +1,184 @@
+#include "LerpSequence.h"
+
+#include "Algo/StableSort.h"
+#include "Components/SceneComponent.h"
+
+FLerpSequence& FLerpSequence::Move(USceneComponent* Component, const FVector& Target, float Duration, const FLerpEasing& Easing)
+{
+    FLerpSequenceTrack& Track = AddTrack(ELerpSequenceTrackType::Vector, Duration, Easing);
+    Track.Component = Component;
+    Track.VectorChannel = ELerpVectorChannel::WorldLocation;
+    Track.VectorEnd = Target;
+    Track.bCaptureStart = true;
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::MoveRelative(USceneComponent* Component, const FVector& Target, float Duration, const FLerpEasing& Easing)
+{
+    FLerpSequenceTrack& Track = AddTrack(ELerpSequenceTrackType::Vector, Duration, Easing);
+    Track.Component = Component;
+    Track.VectorChannel = ELerpVectorChannel::RelativeLocation;
+    Track.VectorEnd = Target;
+    Track.bCaptureStart = true;
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::Rotate(USceneComponent* Component, const FQuat& Target, float Duration, const FLerpEasing& Easing)
+{
+    FLerpSequenceTrack& Track = AddTrack(ELerpSequenceTrackType::Quat, Duration, Easing);
+    Track.Component = Component;
+    Track.RotationChannel = ELerpRotationChannel::World;
+    Track.QuatEnd = Target;
+    Track.bCaptureStart = true;
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::RotateRelative(USceneComponent* Component, const FQuat& Target, float Duration, const FLerpEasing& Easing)
+{
+    FLerpSequenceTrack& Track = AddTrack(ELerpSequenceTrackType::Quat, Duration, Easing);
+    Track.Component = Component;
+    Track.RotationChannel = ELerpRotationChannel::Relative;
+    Track.QuatEnd = Target;
+    Track.bCaptureStart = true;
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::Scale(USceneComponent* Component, const FVector& Target, float Duration, const FLerpEasing& Easing)
+{
+    FLerpSequenceTrack& Track = AddTrack(ELerpSequenceTrackType::Vector, Duration, Easing);
+    Track.Component = Component;
+    Track.VectorChannel = ELerpVectorChannel::WorldScale;
+    Track.VectorEnd = Target;
+    Track.bCaptureStart = true;
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::Float(float Start, float End, float Duration, TFunction<void(float)> OnValue, const FLerpEasing& Easing)
+{
+    // 推进时直接调用，不再检查
+    check(OnValue);
+    FLerpSequenceTrack& Track = AddTrack(ELerpSequenceTrackType::Scalar, Duration, Easing);
+    Track.ScalarStart = Start;
+    Track.ScalarEnd = End;
+    Track.OnValue = MoveTemp(OnValue);
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::Delay(float Seconds)
+{
+    Seconds = FMath::Max(Seconds, 0.0f);
+    if (bInParallel)
+    {
+        ParallelEnd = FMath::Max(ParallelEnd, Cursor + Seconds);
+    }
+    else
+    {
+        Cursor += Seconds;
+    }
+    Length = FMath::Max(Length, bInParallel ? ParallelEnd : Cursor);
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::Call(TFunction<void()> OnReached)
+{
+    check(OnReached);
+    FLerpSequenceTrack& Track = AddTrack(ELerpSequenceTrackType::Callback, 0.0f, FLerpEasing());
+    Track.OnReached = MoveTemp(OnReached);
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::BeginParallel()
+{
+    check(!bInParallel);
+    bInParallel = true;
+    ParallelEnd = Cursor;
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::EndParallel()
+{
+    check(bInParallel);
+    bInParallel = false;
+    Cursor = ParallelEnd;
+    return *this;
+}
+
+FLerpSequence& FLerpSequence::SetLoops(int32 Count, bool bInPingPong)
+{
+    NumLoops = Count == INDEX_NONE ? INDEX_NONE : FMath::Max(Count, 1);
+    bPingPong = bInPingPong;
+    return *this;
+}
+
+FLerpSequenceTrack& FLerpSequence::AddTrack(ELerpSequenceTrackType Type, float Duration, const FLerpEasing& Easing)
+{
+    FLerpSequenceTrack& Track = Tracks.AddDefaulted_GetRef();
+    Track.Type = Type;
+    Track.StartTime = Cursor;
+    Track.Duration = FMath::Max(Duration, 0.0f);
+    Track.Easing = Easing;
+
+    const float TrackEnd = Cursor + Track.Duration;
+    if (bInParallel)
+    {
+        ParallelEnd = FMath::Max(ParallelEnd, TrackEnd);
+    }
+    else
+    {
+        Cursor = TrackEnd;
+    }
+    Length = FMath::Max(Length, TrackEnd);
+    return Track;
+}
+
+void FLerpSequence::Finalize()
+{
+    Algo::StableSortBy(Tracks, &FLerpSequenceTrack::StartTime);
+
+    for (int32 Index = 0; Index < Tracks.Num(); ++Index)
+    {
+        FLerpSequenceTrack& Track = Tracks[Index];
+        if (Track.Type != ELerpSequenceTrackType::Vector && Track.Type != ELerpSequenceTrackType::Quat)
+        {
+            continue;
+        }
+        bHasComponentTracks = true;
+
+        // 往前找同一组件同一属性上最近的一段，直接接着它的终点；推进时组件上的值可能还没写回
+        for (int32 PreviousIndex = Index - 1; PreviousIndex >= 0 && Track.bCaptureStart; --PreviousIndex)
+        {
+            const FLerpSequenceTrack& Previous = Tracks[PreviousIndex];
+            if (Previous.Type != Track.Type || Previous.Component != Track.Component)
+            {
+                continue;
+            }
+            if (Track.Type == ELerpSequenceTrackType::Vector && Previous.VectorChannel == Track.VectorChannel)
+            {
+                Track.VectorStart = Previous.VectorEnd;
+                Track.bCaptureStart = false;
+            }
+            else if (Track.Type == ELerpSequenceTrackType::Quat && Previous.RotationChannel == Track.RotationChannel)
+            {
+                Track.QuatStart = Previous.QuatEnd;
+                Track.bCaptureStart = false;
+            }
+        }
+    }
+}
+
+bool FLerpSequence::HasLiveTargets() const
+{
+    if (!bHasComponentTracks)
+    {
+        return true;
+    }
+
+    for (const FLerpSequenceTrack& Track : Tracks)
+    {
+        if (Track.Component.IsValid())
+        {
+            return true;
+        }
+    }
+    return false;
+}
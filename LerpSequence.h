@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LerpTweenStorage.h"
+
+class USceneComponent;
+
+enum class ELerpSequenceTrackType : uint8
+{
+    Vector,
+    Quat,
+    Scalar,
+    // 到达时间点时调用一次
+    Callback,
+};
+
+// 时间轴上的一段插值或一个回调
+struct FLerpSequenceTrack
+{
+    ELerpSequenceTrackType Type = ELerpSequenceTrackType::Vector;
+    float StartTime = 0.0f;
+    float Duration = 0.0f;
+
+    TWeakObjectPtr<USceneComponent> Component;
+    ELerpVectorChannel VectorChannel = ELerpVectorChannel::WorldLocation;
+    ELerpRotationChannel RotationChannel = ELerpRotationChannel::World;
+
+    FVector VectorStart = FVector::ZeroVector;
+    FVector VectorEnd = FVector::ZeroVector;
+    FQuat QuatStart = FQuat::Identity;
+    FQuat QuatEnd = FQuat::Identity;
+    float ScalarStart = 0.0f;
+    float ScalarEnd = 0.0f;
+
+    TFunction<void(float)> OnValue;
+    TFunction<void()> OnReached;
+
+    FLerpEasing Easing;
+    // 开始播放时由子系统填写
+    int32 CurveTableIndex = INDEX_NONE;
+
+    // 第一次推进到这一段时读回组件当前值作为起点
+    bool bCaptureStart = false;
+};
+
+// 把多段插值按时间排成一条时间轴，整体作为一个tween推进，只占一个槽位：
+//
+//     FLerpSequence Sequence;
+//     Sequence.Move(Root, Target, 1.0f)
+//             .BeginParallel().Rotate(Root, TargetRotation, 0.5f).Scale(Root, FVector(2.0f), 0.5f).EndParallel()
+//             .Delay(0.2f)
+//             .Scale(Root, FVector::OneVector, 0.3f)
+//             .Call([] { ... })
+//             .SetLoops(3, true);
+//     ULerpSubsystem::Get(this)->AddSequence(MoveTemp(Sequence));
+//
+// 未给起点的步骤从当前值出发；同一组件同一属性上的后续步骤直接从前一段的终点出发
+class FLerpSequence
+{
+public:
+    FLerpSequence& Move(USceneComponent* Component, const FVector& Target, float Duration, const FLerpEasing& Easing = FLerpEasing());
+    FLerpSequence& MoveRelative(USceneComponent* Component, const FVector& Target, float Duration, const FLerpEasing& Easing = FLerpEasing());
+    FLerpSequence& Rotate(USceneComponent* Component, const FQuat& Target, float Duration, const FLerpEasing& Easing = FLerpEasing());
+    FLerpSequence& RotateRelative(USceneComponent* Component, const FQuat& Target, float Duration, const FLerpEasing& Easing = FLerpEasing());
+    FLerpSequence& Scale(USceneComponent* Component, const FVector& Target, float Duration, const FLerpEasing& Easing = FLerpEasing());
+    // OnValue和下面Call的OnReached都必须已绑定
+    FLerpSequence& Float(float Start, float End, float Duration, TFunction<void(float)> OnValue, const FLerpEasing& Easing = FLerpEasing());
+
+    // 等待一段时间。在并行组内表示整组至少持续这么久
+    FLerpSequence& Delay(float Seconds);
+
+    // 在当前位置调用一次；循环时每一轮都会调用，往返播放时返程也会调用
+    FLerpSequence& Call(TFunction<void()> OnReached);
+
+    // 其间添加的步骤同时开始，整组结束后才接下一步。不支持嵌套
+    FLerpSequence& BeginParallel();
+    FLerpSequence& EndParallel();
+
+    // 播放Count轮，INDEX_NONE为无限循环（一轮时长须大于0，只有回调的序列不能无限循环）。bPingPong时第2、4……轮倒着播放
+    FLerpSequence& SetLoops(int32 Count, bool bInPingPong = false);
+
+    // 一轮的时长
+    float GetDuration() const { return Length; }
+
+    bool IsEmpty() const { return Tracks.Num() == 0; }
+
+private:
+    friend class ULerpSubsystem;
+
+    FLerpSequenceTrack& AddTrack(ELerpSequenceTrackType Type, float Duration, const FLerpEasing& Easing);
+
+    // 按开始时间排序，并把同一组件同一属性上的后续步骤串起来
+    void Finalize();
+
+    // 是否还有存活的目标组件；没有组件类步骤的序列总是存活
+    bool HasLiveTargets() const;
+
+    bool IsLastLoop() const { return NumLoops != INDEX_NONE && CompletedLoops + 1 >= NumLoops; }
+    bool IsReversed() const { return bPingPong && CompletedLoops % 2 == 1; }
+
+    TArray<FLerpSequenceTrack> Tracks;
+
+    // 构建时的游标
+    float Cursor = 0.0f;
+    float ParallelEnd = 0.0f;
+    bool bInParallel = false;
+    float Length = 0.0f;
+
+    int32 NumLoops = 1;
+    bool bPingPong = false;
+
+    // 播放状态
+    int32 CompletedLoops = 0;
+    // 上次求值到的时间轴位置，小于0表示本轮还没求过值
+    float PreviousTime = -1.0f;
+    bool bHasComponentTracks = false;
+    bool bRemoved = false;
+};
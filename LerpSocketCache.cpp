@@ -0,0 +1,110 @@
+#include "LerpSocketCache.h"
+
+#include "Components/SkinnedMeshComponent.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Engine/SkinnedAsset.h"
+
+int32 FLerpSocketCache::Acquire(USceneComponent* Component, FName SocketName)
+{
+    const TTuple<const USceneComponent*, FName> MapKey(Component, SocketName);
+    if (const int32* ExistingIndex = TargetIndices.Find(MapKey))
+    {
+        FTarget& Target = Targets[*ExistingIndex];
+        if (Target.Component.Get() == Component)
+        {
+            ++Target.RefCount;
+            return *ExistingIndex;
+        }
+
+        // 旧组件已被回收，地址被新组件复用。旧目标留给还在用它的tween，引用归零时释放
+        TargetIndices.Remove(MapKey);
+    }
+
+    FTarget NewTarget;
+    NewTarget.Key = Component;
+    NewTarget.Component = Component;
+    NewTarget.SocketName = SocketName;
+    NewTarget.RefCount = 1;
+    ResolveBone(NewTarget);
+
+    const int32 TargetIndex = Targets.Add(MoveTemp(NewTarget));
+    TargetIndices.Add(MapKey, TargetIndex);
+    return TargetIndex;
+}
+
+void FLerpSocketCache::Release(int32 TargetIndex)
+{
+    FTarget& Target = Targets[TargetIndex];
+    if (--Target.RefCount > 0)
+    {
+        return;
+    }
+
+    // 只有登记表仍指向这个目标时才移除登记，地址被复用的情况下登记已经指向新目标
+    const TTuple<const USceneComponent*, FName> MapKey(Target.Key, Target.SocketName);
+    const int32* RegisteredIndex = TargetIndices.Find(MapKey);
+    if (RegisteredIndex && *RegisteredIndex == TargetIndex)
+    {
+        TargetIndices.Remove(MapKey);
+    }
+    Targets.RemoveAt(TargetIndex);
+}
+
+const FVector& FLerpSocketCache::GetLocation(int32 TargetIndex)
+{
+    FTarget& Target = Targets[TargetIndex];
+    if (Target.ResolvedStep == CurrentStep)
+    {
+        return Target.Location;
+    }
+
+    USceneComponent* Component = Target.Component.Get();
+    const USkinnedMeshComponent* SkinnedMesh = Cast<USkinnedMeshComponent>(Component);
+
+    // 换过网格后旧的骨骼下标可能指向另一根骨骼，Socket的偏移也可能不同，按新网格重新解析
+    if (SkinnedMesh && SkinnedMesh->GetSkinnedAsset() != Target.SkinnedAsset.Get())
+    {
+        ResolveBone(Target);
+    }
+
+    // 没有解析出骨骼，或网格尚未初始化好骨骼时退回按名字查找
+    if (SkinnedMesh && Target.BoneIndex != INDEX_NONE && Target.BoneIndex < SkinnedMesh->GetNumBones())
+    {
+        Target.Location = SkinnedMesh->GetBoneTransform(Target.BoneIndex).TransformPosition(Target.BoneOffset.GetLocation());
+    }
+    else
+    {
+        Target.Location = Component->GetSocketLocation(Target.SocketName);
+    }
+    Target.ResolvedStep = CurrentStep;
+    return Target.Location;
+}
+
+void FLerpSocketCache::ResolveBone(FTarget& Target)
+{
+    Target.BoneIndex = INDEX_NONE;
+    Target.BoneOffset = FTransform::Identity;
+
+    const USkinnedMeshComponent* SkinnedMesh = Cast<USkinnedMeshComponent>(Target.Component.Get());
+    if (!SkinnedMesh)
+    {
+        return;
+    }
+
+    Target.SkinnedAsset = SkinnedMesh->GetSkinnedAsset();
+    if (Target.SocketName.IsNone())
+    {
+        return;
+    }
+
+    // 网格上定义的Socket挂在某根骨骼上并带有相对偏移；否则把名字当作骨骼名
+    if (const USkeletalMeshSocket* Socket = SkinnedMesh->GetSocketByName(Target.SocketName))
+    {
+        Target.BoneIndex = SkinnedMesh->GetBoneIndex(Socket->BoneName);
+        Target.BoneOffset = Socket->GetSocketLocalTransform();
+    }
+    else
+    {
+        Target.BoneIndex = SkinnedMesh->GetBoneIndex(Target.SocketName);
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USceneComponent;
+class USkinnedAsset;
+
+// 跟随tween的目标Socket缓存：同一(组件, Socket)只登记一次，所有跟随它的tween共用。
+// 骨骼Socket在登记时解析出骨骼下标和相对骨骼的偏移，之后每步最多求一次世界位置；组件换了网格时重新解析
+class FLerpSocketCache
+{
+public:
+    // 返回目标下标，每次Acquire都要对应一次Release
+    int32 Acquire(USceneComponent* Component, FName SocketName);
+    void Release(int32 TargetIndex);
+
+    // 新的一步开始，之前求出的位置全部作废
+    void BeginStep() { ++CurrentStep; }
+
+    bool IsAlive(int32 TargetIndex) const { return Targets[TargetIndex].Component.IsValid(); }
+
+    // 本步第一次取时求值，之后直接返回缓存
+    const FVector& GetLocation(int32 TargetIndex);
+
+    int32 Num() const { return Targets.Num(); }
+
+private:
+    struct FTarget
+    {
+        // 登记时的地址；组件被回收、地址被复用时靠弱指针识别出旧目标
+        const USceneComponent* Key = nullptr;
+        TWeakObjectPtr<USceneComponent> Component;
+        FName SocketName;
+        // 骨骼Socket解析结果，不是骨骼Socket时为INDEX_NONE，走GetSocketLocation
+        int32 BoneIndex = INDEX_NONE;
+        FTransform BoneOffset;
+        // 解析BoneIndex和BoneOffset时组件使用的网格，换了网格就要重新解析
+        TWeakObjectPtr<const USkinnedAsset> SkinnedAsset;
+        FVector Location = FVector::ZeroVector;
+        uint32 ResolvedStep = 0;
+        int32 RefCount = 0;
+    };
+
+    static void ResolveBone(FTarget& Target);
+
+    TSparseArray<FTarget> Targets;
+    TMap<TTuple<const USceneComponent*, FName>, int32> TargetIndices;
+    uint32 CurrentStep = 1;
+};
@@ -0,0 +1,1912 @@
+#include "LerpSubsystem.h"
+#include "LerpCore/LerpCoreKernels.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Components/SceneComponent.h"
+#include "Camera/CameraComponent.h"
+#include "UObject/UnrealType.h"
+#include "Misc/App.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+static TAutoConsoleVariable<float> CVarLerpUpdateInterval(
+    TEXT("Lerp.UpdateInterval"),
+    0.0f,
+    TEXT("Minimum seconds between lerp updates. 0 updates every frame.\n")
+    TEXT("Tweens are driven by elapsed time, so a larger interval only makes motion coarser, never slower."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLerpNlerpMaxAngle(
+    TEXT("Lerp.NlerpMaxAngle"),
+    0.0f,
+    TEXT("Rotation tweens whose remaining arc is below this many degrees use normalized lerp instead of slerp.\n")
+    TEXT("Nlerp skips the trig per step at the cost of slightly uneven angular speed. 0 always slerps."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarLerpParallelThreshold(
+    TEXT("Lerp.ParallelThreshold"),
+    4096,
+    TEXT("Tween kinds with at least this many active tweens evaluate in parallel chunks on worker threads.\n")
+    TEXT("Write-back to components stays on the game thread and results match single-threaded mode exactly. 0 disables."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarLerpAsyncEvaluation(
+    TEXT("Lerp.AsyncEvaluation"),
+    0,
+    TEXT("1 evaluates tweens on a background task kicked before actors tick, and writes results back at the subsystem's apply tick group\n")
+    TEXT("(TG_PostUpdateWork by default). Each step uses the delta time captured at kick, so results match synchronous mode. 0 evaluates in the subsystem tick."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLerpSignificanceInterval(
+    TEXT("Lerp.SignificanceInterval"),
+    0.25f,
+    TEXT("Seconds between re-evaluating how often each target's tweens update."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarLerpHiddenStride(
+    TEXT("Lerp.HiddenStride"),
+    1,
+    TEXT("Tweens on actors that were not rendered recently update only every Nth step. 1 disables.\n")
+    TEXT("Actors without any rendered primitive (e.g. camera-only actors) count as hidden."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarLerpFarStride(
+    TEXT("Lerp.FarStride"),
+    1,
+    TEXT("Tweens on actors farther than Lerp.FarDistance from every local player's view update only every Nth step. 1 disables."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLerpFarDistance(
+    TEXT("Lerp.FarDistance"),
+    5000.0f,
+    TEXT("Distance from the nearest local player's view beyond which Lerp.FarStride applies."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarLerpHeadlessCosmetic(
+    TEXT("Lerp.HeadlessCosmetic"),
+    1,
+    TEXT("How dedicated servers and processes that cannot render treat cosmetic tweens.\n")
+    TEXT("0 runs them normally, 1 completes them at their final value on the next step, 2 drops them as cancelled."),
+    ECVF_Default);
+
+DECLARE_STATS_GROUP(TEXT("Lerp"), STATGROUP_Lerp, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Bulk Start"), STAT_LerpBulkStart, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Prepare"), STAT_LerpPrepare, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Significance"), STAT_LerpSignificance, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Evaluate"), STAT_LerpEvaluate, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Wait For Evaluate"), STAT_LerpWaitEvaluate, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Write-back"), STAT_LerpApply, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Write-back Vector"), STAT_LerpApplyVector, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Write-back Rotation"), STAT_LerpApplyQuat, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Write-back Scalar"), STAT_LerpApplyScalar, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Write-back Follow"), STAT_LerpApplyFollow, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Write-back Sequence"), STAT_LerpApplySequence, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Write-back Spring"), STAT_LerpApplySpring, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Transform Flush"), STAT_LerpFlush, STATGROUP_Lerp);
+DECLARE_CYCLE_STAT(TEXT("Dispatch Events"), STAT_LerpDispatchEvents, STATGROUP_Lerp);
+
+// 计数每帧清零，多个World的数量相加
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Vector"), STAT_LerpActiveVector, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Rotation"), STAT_LerpActiveQuat, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Scalar"), STAT_LerpActiveScalar, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Follow"), STAT_LerpActiveFollow, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Sequence"), STAT_LerpActiveSequence, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Spring"), STAT_LerpActiveSpring, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Slot Pool Used"), STAT_LerpSlotPoolUsed, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Slot Pool Capacity"), STAT_LerpSlotPoolCapacity, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Started"), STAT_LerpStarted, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Completed"), STAT_LerpCompleted, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cancelled"), STAT_LerpCancelled, STATGROUP_Lerp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reaped"), STAT_LerpReaped, STATGROUP_Lerp);
+
+// Insights计数器（-trace=counters），多个World时为最后发布的那个
+TRACE_DECLARE_INT_COUNTER(LerpActiveTweens, TEXT("Lerp/Active"));
+TRACE_DECLARE_INT_COUNTER(LerpSlotPoolCapacity, TEXT("Lerp/Slot Pool Capacity"));
+TRACE_DECLARE_INT_COUNTER(LerpStartedTweens, TEXT("Lerp/Started"));
+TRACE_DECLARE_INT_COUNTER(LerpCompletedTweens, TEXT("Lerp/Completed"));
+TRACE_DECLARE_INT_COUNTER(LerpCancelledTweens, TEXT("Lerp/Cancelled"));
+TRACE_DECLARE_INT_COUNTER(LerpReapedTweens, TEXT("Lerp/Reaped"));
+
+// 编入stats时周期计数本身就会出现在Insights的CPU轨道上；Test等关闭stats的版本只留CPU事件
+#if STATS
+#define LERP_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define LERP_SCOPE_CYCLE_COUNTER(Stat) TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif
+
+// LerpCore按行取时间源的倍率；DeltaTime已含全局时间膨胀，这里只给出目标Actor自己的CustomTimeDilation
+float GetTimeDilation(const FLerpTimeSource& TimeSource)
+{
+    const AActor* Actor = TimeSource.Get();
+    return Actor ? Actor->CustomTimeDilation : 1.0f;
+}
+
+namespace
+{
+    // 对象本身或其所属的Actor决定时间膨胀
+    AActor* FindTimeSource(UObject* Object)
+    {
+        AActor* TimeSource = Cast<AActor>(Object);
+        if (!TimeSource && Object)
+        {
+            TimeSource = Object->GetTypedOuter<AActor>();
+        }
+        return TimeSource;
+    }
+
+    // 沿"结构体.成员"路径逐级查找，返回最终的浮点属性及其在Target内存中的地址
+    FNumericProperty* FindFloatingPointProperty(UObject* Target, const FString& PropertyPath, void*& OutAddress)
+    {
+        TArray<FString> PropertyNames;
+        PropertyPath.ParseIntoArray(PropertyNames, TEXT("."));
+
+        const UStruct* Struct = Target->GetClass();
+        void* Container = Target;
+        for (int32 NameIndex = 0; NameIndex < PropertyNames.Num(); ++NameIndex)
+        {
+            FProperty* Property = FindFProperty<FProperty>(Struct, FName(*PropertyNames[NameIndex]));
+            if (!Property)
+            {
+                return nullptr;
+            }
+
+            void* Address = Property->ContainerPtrToValuePtr<void>(Container);
+            if (NameIndex == PropertyNames.Num() - 1)
+            {
+                FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+                if (!NumericProperty || !NumericProperty->IsFloatingPoint())
+                {
+                    return nullptr;
+                }
+                OutAddress = Address;
+                return NumericProperty;
+            }
+
+            const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+            if (!StructProperty)
+            {
+                return nullptr;
+            }
+            Struct = StructProperty->Struct;
+            Container = Address;
+        }
+        return nullptr;
+    }
+
+    // 按名字区分的通道：名字比较相同的FName得到相同的键
+    FLerpChannelKey MakeParameterChannelKey(const UObject* Target, FName Name)
+    {
+        if (!Target || Name.IsNone())
+        {
+            return FLerpChannelKey();
+        }
+        const uint64 NameKey = (static_cast<uint64>(Name.GetComparisonIndex().ToUnstableInt()) << 32) | static_cast<uint32>(Name.GetNumber());
+        return FLerpChannelKey(Target, ELerpChannel::Parameter, NameKey);
+    }
+
+    // 标量行可能是Blend改写的旧行，先清掉其他写入目标的列
+    void ResetScalarSink(FLerpScalarTweens& Tweens, int32 Index, ELerpScalarSink Sink)
+    {
+        Tweens.Sinks[Index] = Sink;
+        Tweens.Cameras[Index] = nullptr;
+        Tweens.ValuePtrs[Index] = nullptr;
+        Tweens.Properties[Index] = nullptr;
+        Tweens.PropertyAddresses[Index] = nullptr;
+        Tweens.ValueOwners[Index] = nullptr;
+        Tweens.Setters[Index].Unbind();
+        Tweens.Callbacks[Index].Reset();
+    }
+
+    bool IsScalarSinkAlive(const FLerpScalarTweens& Tweens, int32 Index)
+    {
+        switch (Tweens.Sinks[Index])
+        {
+        case ELerpScalarSink::CameraFOV:
+            return Tweens.Cameras[Index].IsValid();
+        case ELerpScalarSink::FloatPointer:
+        case ELerpScalarSink::Property:
+            return Tweens.ValueOwners[Index].IsValid();
+        case ELerpScalarSink::Setter:
+            return Tweens.Setters[Index].IsBound();
+        case ELerpScalarSink::Callback:
+            return Tweens.Callbacks[Index].IsValid() && (Tweens.ValueOwners[Index].IsExplicitlyNull() || Tweens.ValueOwners[Index].IsValid());
+        }
+        return false;
+    }
+
+    FVector ReadVectorChannel(const USceneComponent* Component, ELerpVectorChannel Channel)
+    {
+        switch (Channel)
+        {
+        case ELerpVectorChannel::RelativeLocation:
+            return Component->GetRelativeLocation();
+        case ELerpVectorChannel::WorldScale:
+            return Component->GetComponentScale();
+        default:
+            return Component->GetComponentLocation();
+        }
+    }
+
+    // 相对旋转经组件自带的转换缓存取四元数，未变化时不做三角运算
+    FQuat ReadRotationChannel(const USceneComponent* Component, ELerpRotationChannel Channel)
+    {
+        return Channel == ELerpRotationChannel::Relative
+            ? Component->GetRelativeRotationCache().RotatorToQuat(Component->GetRelativeRotation())
+            : Component->GetComponentQuat();
+    }
+
+    // 弹簧停稳的距离和速度阈值，到达后直接写入目标并结束
+    constexpr float SpringSettleTolerance = 1.e-3f;
+
+    // FromCurrent每步都读回当前值，CaptureStart只读一次。
+    // 延迟中的行每步都读，延迟结束的那一步由GatherStep清掉CaptureStart
+    bool ConsumeReadCurrent(FLerpTweenColumns& Tweens, int32 Index)
+    {
+        ELerpTweenFlags& Flags = Tweens.Flags[Index];
+        const bool bReadCurrent = EnumHasAnyFlags(Flags, ELerpTweenFlags::FromCurrent | ELerpTweenFlags::CaptureStart);
+        if (!LerpTweenStep::IsDelayed(Tweens, Index))
+        {
+            EnumRemoveFlags(Flags, ELerpTweenFlags::CaptureStart);
+        }
+        return bReadCurrent;
+    }
+}
+
+ULerpSubsystem* ULerpSubsystem::Get(const UObject* WorldContextObject)
+{
+    if (!WorldContextObject || !GEngine)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+    return World ? World->GetSubsystem<ULerpSubsystem>() : nullptr;
+}
+
+template <typename TweensType>
+int32 ULerpSubsystem::BeginTween(TweensType& Tweens, ELerpTweenKind Kind, const FLerpChannelKey& ChannelKey, ELerpConflict Conflict, float Duration, ELerpTweenFlags Flags, AActor* TimeSource, const FLerpEasing& Easing, FLerpHandle& OutHandle)
+{
+    WaitForEvaluation();
+
+    if (!ChannelKey.Target)
+    {
+        const int32 Index = AddTweenRow(Tweens, Kind, Duration, Flags, TimeSource, OutHandle);
+        SetTweenEasing(Tweens, Index, Easing);
+        return Index;
+    }
+
+    if (const int32* OwnerSlotPtr = ChannelOwners.Find(ChannelKey))
+    {
+        const int32 OwnerSlot = *OwnerSlotPtr;
+
+        if (Conflict == ELerpConflict::Blend && SlotPool[OwnerSlot].Kind == Kind)
+        {
+            // 就地改写：从当前值出发重新计时，保留暂停状态和句柄
+            const int32 Index = SlotPool[OwnerSlot].DenseIndex;
+            const ELerpTweenFlags KeptFlags = Tweens.Flags[Index] & ELerpTweenFlags::Paused;
+            Tweens.Elapsed[Index] = 0.0f;
+            Tweens.DeferredTimes[Index] = 0.0f;
+            Tweens.Durations[Index] = Duration;
+            Tweens.Flags[Index] = Flags | KeptFlags | ELerpTweenFlags::CaptureStart;
+            Tweens.TimeSources[Index] = TimeSource;
+            SetTweenEasing(Tweens, Index, Easing);
+            OutHandle = SlotPool.MakeHandle(OwnerSlot);
+            return Index;
+        }
+
+        if (Conflict == ELerpConflict::Queue)
+        {
+            const int32 Index = AddTweenRow(Tweens, Kind, Duration, Flags | ELerpTweenFlags::Queued | ELerpTweenFlags::CaptureStart, TimeSource, OutHandle);
+
+            int32 TailSlot = OwnerSlot;
+            while (SlotPool[TailSlot].NextQueued != INDEX_NONE)
+            {
+                TailSlot = SlotPool[TailSlot].NextQueued;
+            }
+            SlotPool[TailSlot].NextQueued = OutHandle.Index;
+            SlotPool[OutHandle.Index].ChannelKey = ChannelKey;
+            SetTweenEasing(Tweens, Index, Easing);
+            return Index;
+        }
+
+        // Replace，以及种类不同无法就地改写的Blend
+        CancelChannel(ChannelKey);
+    }
+
+    const int32 Index = AddTweenRow(Tweens, Kind, Duration, Flags, TimeSource, OutHandle);
+    SlotPool[OutHandle.Index].ChannelKey = ChannelKey;
+    ChannelOwners.Add(ChannelKey, OutHandle.Index);
+    SetTweenEasing(Tweens, Index, Easing);
+    return Index;
+}
+
+void ULerpSubsystem::SetTweenEasing(FLerpTweenColumns& Tweens, int32 Index, const FLerpEasing& Easing)
+{
+    ReleaseTweenCurve(Tweens, Index);
+
+    if (Easing.VectorCurve && &Tweens == &VectorTweens)
+    {
+        Tweens.Eases[Index] = ELerpEase::VectorCurve;
+        Tweens.CurveTableIndices[Index] = CurveTables.AddVectorCurve(Easing.VectorCurve);
+        ++NumVectorCurveTweens;
+    }
+    else if (Easing.Curve)
+    {
+        Tweens.Eases[Index] = ELerpEase::Curve;
+        Tweens.CurveTableIndices[Index] = CurveTables.AddFloatCurve(Easing.Curve);
+    }
+    else
+    {
+        // 没有曲线时Curve/VectorCurve退化为Linear
+        Tweens.Eases[Index] = Easing.Ease >= ELerpEase::Curve ? ELerpEase::Linear : Easing.Ease;
+    }
+}
+
+void ULerpSubsystem::ReleaseTweenCurve(FLerpTweenColumns& Tweens, int32 Index)
+{
+    if (Tweens.CurveTableIndices[Index] == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (Tweens.Eases[Index] == ELerpEase::VectorCurve)
+    {
+        --NumVectorCurveTweens;
+    }
+    CurveTables.Release(Tweens.CurveTableIndices[Index]);
+    Tweens.CurveTableIndices[Index] = INDEX_NONE;
+}
+
+void ULerpSubsystem::GatherStep(FLerpTweenColumns& Tweens, FLerpStepColumns& Step, float DeltaTime)
+{
+    // 各行的CustomTimeDilation先在游戏线程上逐行取好，分块计算只读数值列
+    LerpTweenStep::GatherStep(Tweens, Step, DeltaTime, StepIndex, StepParallelThreshold);
+}
+
+void ULerpSubsystem::SetSignificanceFunction(TFunction<int32(const AActor*)> Function)
+{
+    SignificanceFunction = MoveTemp(Function);
+    // 下一步立即按新的函数重新评估
+    SignificanceAge = TNumericLimits<float>::Max();
+}
+
+void ULerpSubsystem::UpdateStrides(float DeltaTime)
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpSignificance);
+
+    SignificanceAge += DeltaTime;
+    if (SignificanceAge < CVarLerpSignificanceInterval.GetValueOnGameThread())
+    {
+        return;
+    }
+    SignificanceAge = 0.0f;
+
+    const int32 HiddenStride = FMath::Clamp(CVarLerpHiddenStride.GetValueOnGameThread(), 1, static_cast<int32>(MAX_uint8));
+    const int32 FarStride = FMath::Clamp(CVarLerpFarStride.GetValueOnGameThread(), 1, static_cast<int32>(MAX_uint8));
+    const bool bThrottle = SignificanceFunction || HiddenStride > 1 || FarStride > 1;
+    if (!bThrottle && !bHasThrottledTweens)
+    {
+        return;
+    }
+
+    // 本地玩家的视点；专用服务器上没有，距离不参与判断
+    TArray<FVector, TInlineAllocator<4>> ViewLocations;
+    if (bThrottle && !SignificanceFunction && FarStride > 1)
+    {
+        for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+        {
+            const APlayerController* PlayerController = It->Get();
+            if (PlayerController && PlayerController->IsLocalController())
+            {
+                FVector ViewLocation;
+                FRotator ViewRotation;
+                PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+                ViewLocations.Add(ViewLocation);
+            }
+        }
+    }
+    const double FarDistanceSquared = FMath::Square(static_cast<double>(CVarLerpFarDistance.GetValueOnGameThread()));
+
+    // 同一Actor的多个tween只评估一次
+    TMap<const AActor*, uint8, TInlineSetAllocator<64>> ActorStrides;
+    auto GetStride = [&](const AActor* Target) -> uint8
+    {
+        if (!bThrottle || !Target)
+        {
+            return 1;
+        }
+        if (const uint8* Stride = ActorStrides.Find(Target))
+        {
+            return *Stride;
+        }
+
+        int32 Stride = 1;
+        if (SignificanceFunction)
+        {
+            Stride = SignificanceFunction(Target);
+        }
+        else if (HiddenStride > 1 && !Target->WasRecentlyRendered())
+        {
+            Stride = HiddenStride;
+        }
+        else if (ViewLocations.Num() > 0)
+        {
+            const FVector Location = Target->GetActorLocation();
+            double NearestSquared = TNumericLimits<double>::Max();
+            for (const FVector& ViewLocation : ViewLocations)
+            {
+                NearestSquared = FMath::Min(NearestSquared, FVector::DistSquared(Location, ViewLocation));
+            }
+            Stride = NearestSquared > FarDistanceSquared ? FarStride : 1;
+        }
+        return ActorStrides.Add(Target, static_cast<uint8>(FMath::Clamp(Stride, 1, static_cast<int32>(MAX_uint8))));
+    };
+
+    bHasThrottledTweens = false;
+    FLerpTweenColumns* const AllTweens[] = { &VectorTweens, &QuatTweens, &ScalarTweens, &FollowTweens, &SequenceTweens, &SpringTweens };
+    for (FLerpTweenColumns* Tweens : AllTweens)
+    {
+        for (int32 Index = 0; Index < Tweens->Num(); ++Index)
+        {
+            const uint8 Stride = GetStride(Tweens->TimeSources[Index].Get());
+            Tweens->Strides[Index] = Stride;
+            bHasThrottledTweens |= Stride > 1;
+        }
+    }
+}
+
+void ULerpSubsystem::AdvanceTweens(FLerpTweenColumns& Tweens, FLerpStepColumns& Step)
+{
+    LerpTweenStep::AdvanceTweens(Tweens, Step, CurveTables.GetSamples(), StepParallelThreshold, StepEaseRows);
+}
+
+template <typename TweensType>
+int32 ULerpSubsystem::AddTweenRow(TweensType& Tweens, ELerpTweenKind Kind, float Duration, ELerpTweenFlags Flags, AActor* TimeSource, FLerpHandle& OutHandle)
+{
+    const int32 Index = LerpTweenStorage::AddTween(Tweens, Duration, Flags, TimeSource);
+    OutHandle = SlotPool.Allocate(Kind, Index);
+    Tweens.SlotIndices[Index] = OutHandle.Index;
+    ++FrameStartedTweens;
+    if constexpr (std::is_same_v<TweensType, FLerpFollowTweens>)
+    {
+        Tweens.SocketTargets[Index] = INDEX_NONE;
+    }
+    else if constexpr (std::is_same_v<TweensType, FLerpSpringTweens>)
+    {
+        Tweens.SocketTargets[Index] = INDEX_NONE;
+        Tweens.Velocities[Index] = FVector::ZeroVector;
+    }
+    return Index;
+}
+
+template <typename TweensType>
+void ULerpSubsystem::RemoveTweenRow(TweensType& Tweens, int32 Index, ELerpFinishReason Reason)
+{
+    const int32 SlotIndex = Tweens.SlotIndices[Index];
+    UnlinkChannel(SlotIndex);
+    ReleaseTweenCurve(Tweens, Index);
+    if constexpr (std::is_same_v<TweensType, FLerpFollowTweens>)
+    {
+        SocketCache.Release(Tweens.SocketTargets[Index]);
+    }
+    else if constexpr (std::is_same_v<TweensType, FLerpSpringTweens>)
+    {
+        if (Tweens.SocketTargets[Index] != INDEX_NONE)
+        {
+            SocketCache.Release(Tweens.SocketTargets[Index]);
+        }
+    }
+    else if constexpr (std::is_same_v<TweensType, FLerpSequenceTweens>)
+    {
+        // 回调里取消自身时，正在求值的序列据此停下
+        Tweens.Sequences[Index]->bRemoved = true;
+        for (const FLerpSequenceTrack& Track : Tweens.Sequences[Index]->Tracks)
+        {
+            if (Track.CurveTableIndex != INDEX_NONE)
+            {
+                CurveTables.Release(Track.CurveTableIndex);
+            }
+        }
+    }
+
+    const int32 LastIndex = Tweens.Num() - 1;
+    if (Index != LastIndex)
+    {
+        SlotPool[Tweens.SlotIndices[LastIndex]].DenseIndex = Index;
+    }
+
+    FLerpFinishEvent Event{ SlotPool.MakeHandle(SlotIndex), Reason };
+    for (TMultiMap<int32, FLerpTweenListener>::TKeyIterator It = Listeners.CreateKeyIterator(SlotIndex); It; ++It)
+    {
+        Event.OnFinished.Add(MoveTemp(It.Value().OnFinished));
+        It.RemoveCurrent();
+    }
+    if (Event.OnFinished.Num() > 0 || LerpFinished.IsBound())
+    {
+        PendingFinishEvents.Add(MoveTemp(Event));
+    }
+
+    LerpTweenStorage::RemoveTween(Tweens, Index);
+    SlotPool.Release(SlotIndex);
+    ++FrameFinishedTweens[static_cast<int32>(Reason)];
+}
+
+template <typename TweensType>
+void ULerpSubsystem::ReapTweenRow(TweensType& Tweens, int32 Index)
+{
+    ++NumReapedTweens;
+    RemoveTweenRow(Tweens, Index, ELerpFinishReason::TargetDestroyed);
+}
+
+void ULerpSubsystem::RemoveTween(int32 SlotIndex, ELerpFinishReason Reason)
+{
+    const FLerpSlot& Slot = SlotPool[SlotIndex];
+    VisitTweens(Slot.Kind, [this, DenseIndex = Slot.DenseIndex, Reason](auto& Tweens)
+    {
+        RemoveTweenRow(Tweens, DenseIndex, Reason);
+    });
+}
+
+void ULerpSubsystem::CancelChannel(const FLerpChannelKey& ChannelKey)
+{
+    const int32* OwnerSlotPtr = ChannelOwners.Find(ChannelKey);
+    if (!OwnerSlotPtr)
+    {
+        return;
+    }
+
+    // 从队尾往前删，每次删掉的都不是通道的占用者，不会触发排队激活
+    TArray<int32, TInlineAllocator<8>> ChainSlots;
+    for (int32 SlotIndex = *OwnerSlotPtr; SlotIndex != INDEX_NONE; SlotIndex = SlotPool[SlotIndex].NextQueued)
+    {
+        ChainSlots.Add(SlotIndex);
+    }
+    for (int32 ChainIndex = ChainSlots.Num() - 1; ChainIndex >= 0; --ChainIndex)
+    {
+        RemoveTween(ChainSlots[ChainIndex], ELerpFinishReason::Cancelled);
+    }
+}
+
+void ULerpSubsystem::UnlinkChannel(int32 SlotIndex)
+{
+    FLerpSlot& Slot = SlotPool[SlotIndex];
+    if (!Slot.ChannelKey.Target)
+    {
+        return;
+    }
+
+    if (int32* OwnerSlot = ChannelOwners.Find(Slot.ChannelKey))
+    {
+        if (*OwnerSlot == SlotIndex)
+        {
+            if (Slot.NextQueued != INDEX_NONE)
+            {
+                *OwnerSlot = Slot.NextQueued;
+                PendingActivations.Add(SlotPool.MakeHandle(Slot.NextQueued));
+            }
+            else
+            {
+                ChannelOwners.Remove(Slot.ChannelKey);
+            }
+        }
+        else
+        {
+            for (int32 PrevSlot = *OwnerSlot; PrevSlot != INDEX_NONE; PrevSlot = SlotPool[PrevSlot].NextQueued)
+            {
+                if (SlotPool[PrevSlot].NextQueued == SlotIndex)
+                {
+                    SlotPool[PrevSlot].NextQueued = Slot.NextQueued;
+                    break;
+                }
+            }
+        }
+    }
+
+    Slot.ChannelKey = FLerpChannelKey();
+    Slot.NextQueued = INDEX_NONE;
+}
+
+void ULerpSubsystem::ActivateQueuedTweens()
+{
+    for (const FLerpHandle& Handle : PendingActivations)
+    {
+        // 轮到之前可能已被取消
+        if (const FLerpSlot* Slot = SlotPool.Find(Handle))
+        {
+            EnumRemoveFlags(GetColumns(Slot->Kind).Flags[Slot->DenseIndex], ELerpTweenFlags::Queued);
+        }
+    }
+    PendingActivations.Reset();
+}
+
+FLerpHandle ULerpSubsystem::AddVectorTween(USceneComponent* Component, ELerpVectorChannel Channel, const FVector& Start, const FVector& End, float Duration, ELerpTweenFlags Flags, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    const FLerpChannelKey ChannelKey(Component, Channel == ELerpVectorChannel::WorldScale ? ELerpChannel::Scale : ELerpChannel::Location);
+
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(VectorTweens, ELerpTweenKind::Vector, ChannelKey, Conflict, Duration, Flags, Component->GetOwner(), Easing, Handle);
+    VectorTweens.Components[Index] = Component;
+    VectorTweens.Channels[Index] = Channel;
+    VectorTweens.Starts[Index] = Start;
+    VectorTweens.Ends[Index] = End;
+    return Handle;
+}
+
+void ULerpSubsystem::AddVectorTweens(const TArray<USceneComponent*>& Components, ELerpVectorChannel Channel, const TArray<FVector>& Ends, const TArray<float>& Durations, const TArray<float>& Delays, ELerpConflict Conflict, const FLerpEasing& Easing, TArray<FLerpHandle>& OutHandles)
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpBulkStart);
+
+    const int32 NumTweens = Components.Num();
+    OutHandles.Reset(NumTweens);
+    OutHandles.SetNum(NumTweens);
+    if (Ends.Num() != NumTweens || (Durations.Num() != 1 && Durations.Num() != NumTweens) || (Delays.Num() > 1 && Delays.Num() != NumTweens))
+    {
+        return;
+    }
+
+    // 列、槽位池和通道登记表一次预留到位，逐个插入时不再扩容
+    WaitForEvaluation();
+    LerpTweenStorage::Reserve(VectorTweens, VectorTweens.Num() + NumTweens);
+    SlotPool.Reserve(SlotPool.GetNumActive() + NumTweens);
+    ChannelOwners.Reserve(ChannelOwners.Num() + NumTweens);
+
+    const ELerpChannel ConflictChannel = Channel == ELerpVectorChannel::WorldScale ? ELerpChannel::Scale : ELerpChannel::Location;
+    for (int32 Element = 0; Element < NumTweens; ++Element)
+    {
+        USceneComponent* Component = Components[Element];
+        const float Duration = Durations[Durations.Num() == 1 ? 0 : Element];
+        if (!Component || Duration <= 0.0f)
+        {
+            continue;
+        }
+
+        const float Delay = Delays.Num() == 0 ? 0.0f : Delays[Delays.Num() == 1 ? 0 : Element];
+        const int32 Index = BeginTween(VectorTweens, ELerpTweenKind::Vector, FLerpChannelKey(Component, ConflictChannel), Conflict, Duration, ELerpTweenFlags::CaptureStart, Component->GetOwner(), Easing, OutHandles[Element]);
+        VectorTweens.Components[Index] = Component;
+        VectorTweens.Channels[Index] = Channel;
+        VectorTweens.Ends[Index] = Ends[Element];
+        VectorTweens.Elapsed[Index] = -FMath::Max(Delay, 0.0f);
+    }
+}
+
+FLerpHandle ULerpSubsystem::AddQuatTween(USceneComponent* Component, ELerpRotationChannel Channel, const FQuat& Start, const FQuat& End, float Duration, ELerpTweenFlags Flags, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(QuatTweens, ELerpTweenKind::Quat, FLerpChannelKey(Component, ELerpChannel::Rotation), Conflict, Duration, Flags, Component->GetOwner(), Easing, Handle);
+    QuatTweens.Components[Index] = Component;
+    QuatTweens.Channels[Index] = Channel;
+    QuatTweens.Starts[Index] = Start;
+    QuatTweens.Ends[Index] = End;
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddCameraFOVTween(UCameraComponent* Camera, float StartFOV, float EndFOV, float Duration, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(ScalarTweens, ELerpTweenKind::Scalar, FLerpChannelKey(Camera, ELerpChannel::FieldOfView), Conflict, Duration, ELerpTweenFlags::None, Camera->GetOwner(), Easing, Handle);
+    ResetScalarSink(ScalarTweens, Index, ELerpScalarSink::CameraFOV);
+    ScalarTweens.Cameras[Index] = Camera;
+    ScalarTweens.Starts[Index] = StartFOV;
+    ScalarTweens.Ends[Index] = EndFOV;
+    SetTweenRelevance(Handle, ELerpRelevance::Auto);
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddFloatTween(UObject* WorldContextObject, float* ValuePtr, float TargetValue, float Duration, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    // 起点只在开始时取一次，按时间线性插值（原写法每步从当前值出发，实际是指数逼近）
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(ScalarTweens, ELerpTweenKind::Scalar, FLerpChannelKey(ValuePtr, ELerpChannel::Float), Conflict, Duration, ELerpTweenFlags::None, FindTimeSource(WorldContextObject), Easing, Handle);
+    ResetScalarSink(ScalarTweens, Index, ELerpScalarSink::FloatPointer);
+    ScalarTweens.ValuePtrs[Index] = ValuePtr;
+    ScalarTweens.ValueOwners[Index] = WorldContextObject;
+    ScalarTweens.Starts[Index] = *ValuePtr;
+    ScalarTweens.Ends[Index] = TargetValue;
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddPropertyTween(UObject* Target, const FString& PropertyPath, float TargetValue, float Duration, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    void* Address = nullptr;
+    FNumericProperty* Property = Target ? FindFloatingPointProperty(Target, PropertyPath, Address) : nullptr;
+    if (!Property)
+    {
+        return FLerpHandle();
+    }
+
+    // 与LerpFloatToTarget共用Float通道：同一地址上的lerp互相冲突
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(ScalarTweens, ELerpTweenKind::Scalar, FLerpChannelKey(Address, ELerpChannel::Float), Conflict, Duration, ELerpTweenFlags::None, FindTimeSource(Target), Easing, Handle);
+    ResetScalarSink(ScalarTweens, Index, ELerpScalarSink::Property);
+    ScalarTweens.Properties[Index] = Property;
+    ScalarTweens.PropertyAddresses[Index] = Address;
+    ScalarTweens.ValueOwners[Index] = Target;
+    ScalarTweens.Starts[Index] = static_cast<float>(Property->GetFloatingPointPropertyValue(Address));
+    ScalarTweens.Ends[Index] = TargetValue;
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddSetterTween(const FLerpFloatSetter& Setter, float Start, float End, float Duration, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    FLerpHandle Handle;
+    const FLerpChannelKey ChannelKey = MakeParameterChannelKey(Setter.GetUObject(), Setter.GetFunctionName());
+    const int32 Index = BeginTween(ScalarTweens, ELerpTweenKind::Scalar, ChannelKey, Conflict, Duration, ELerpTweenFlags::None, FindTimeSource(Setter.GetUObject()), Easing, Handle);
+    ResetScalarSink(ScalarTweens, Index, ELerpScalarSink::Setter);
+    ScalarTweens.Setters[Index] = Setter;
+    ScalarTweens.Starts[Index] = Start;
+    ScalarTweens.Ends[Index] = End;
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddCallbackTween(UObject* Owner, FName ChannelName, float Start, float End, float Duration, TFunction<void(float)> Callback, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(ScalarTweens, ELerpTweenKind::Scalar, MakeParameterChannelKey(Owner, ChannelName), Conflict, Duration, ELerpTweenFlags::None, FindTimeSource(Owner), Easing, Handle);
+    ResetScalarSink(ScalarTweens, Index, ELerpScalarSink::Callback);
+    ScalarTweens.ValueOwners[Index] = Owner;
+    ScalarTweens.Callbacks[Index] = MakeShared<TFunction<void(float)>, ESPMode::NotThreadSafe>(MoveTemp(Callback));
+    ScalarTweens.Starts[Index] = Start;
+    ScalarTweens.Ends[Index] = End;
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddFollowTween(USceneComponent* Component, USceneComponent* SocketParent, FName SocketName, const FVector& Start, float Duration, ELerpConflict Conflict, const FLerpEasing& Easing)
+{
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(FollowTweens, ELerpTweenKind::Follow, FLerpChannelKey(Component, ELerpChannel::Location), Conflict, Duration, ELerpTweenFlags::None, Component->GetOwner(), Easing, Handle);
+    FollowTweens.Components[Index] = Component;
+    // Blend改写的旧行先放掉原来的目标
+    const int32 PreviousTarget = FollowTweens.SocketTargets[Index];
+    FollowTweens.SocketTargets[Index] = SocketCache.Acquire(SocketParent, SocketName);
+    if (PreviousTarget != INDEX_NONE)
+    {
+        SocketCache.Release(PreviousTarget);
+    }
+    FollowTweens.Starts[Index] = Start;
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddSpringTween(USceneComponent* Component, ELerpVectorChannel Channel, const FVector& Target, float SmoothTime, ELerpConflict Conflict)
+{
+    const FLerpChannelKey ChannelKey(Component, Channel == ELerpVectorChannel::WorldScale ? ELerpChannel::Scale : ELerpChannel::Location);
+
+    // 没有固定时长，Elapsed只在FinishTween时被推到终点
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(SpringTweens, ELerpTweenKind::Spring, ChannelKey, Conflict, TNumericLimits<float>::Max(), ELerpTweenFlags::CaptureStart, Component->GetOwner(), FLerpEasing(), Handle);
+    SpringTweens.Components[Index] = Component;
+    SpringTweens.Channels[Index] = Channel;
+    SpringTweens.Targets[Index] = Target;
+    SpringTweens.SmoothTimes[Index] = FMath::Max(SmoothTime, KINDA_SMALL_NUMBER);
+    if (SpringTweens.SocketTargets[Index] != INDEX_NONE)
+    {
+        SocketCache.Release(SpringTweens.SocketTargets[Index]);
+        SpringTweens.SocketTargets[Index] = INDEX_NONE;
+    }
+    return Handle;
+}
+
+FLerpHandle ULerpSubsystem::AddSpringFollowTween(USceneComponent* Component, USceneComponent* SocketParent, FName SocketName, float SmoothTime, ELerpConflict Conflict)
+{
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(SpringTweens, ELerpTweenKind::Spring, FLerpChannelKey(Component, ELerpChannel::Location), Conflict, TNumericLimits<float>::Max(), ELerpTweenFlags::CaptureStart, Component->GetOwner(), FLerpEasing(), Handle);
+    SpringTweens.Components[Index] = Component;
+    SpringTweens.Channels[Index] = ELerpVectorChannel::WorldLocation;
+    SpringTweens.SmoothTimes[Index] = FMath::Max(SmoothTime, KINDA_SMALL_NUMBER);
+    // Blend改写的旧行先放掉原来的目标
+    const int32 PreviousTarget = SpringTweens.SocketTargets[Index];
+    SpringTweens.SocketTargets[Index] = SocketCache.Acquire(SocketParent, SocketName);
+    if (PreviousTarget != INDEX_NONE)
+    {
+        SocketCache.Release(PreviousTarget);
+    }
+    return Handle;
+}
+
+bool ULerpSubsystem::SetSpringTarget(const FLerpHandle& Handle, const FVector& Target)
+{
+    const FLerpSlot* Slot = SlotPool.Find(Handle);
+    if (!Slot || Slot->Kind != ELerpTweenKind::Spring)
+    {
+        return false;
+    }
+
+    WaitForEvaluation();
+    const int32 Index = Slot->DenseIndex;
+    SpringTweens.Targets[Index] = Target;
+    if (SpringTweens.SocketTargets[Index] != INDEX_NONE)
+    {
+        SocketCache.Release(SpringTweens.SocketTargets[Index]);
+        SpringTweens.SocketTargets[Index] = INDEX_NONE;
+    }
+    return true;
+}
+
+FLerpHandle ULerpSubsystem::AddSequence(FLerpSequence Sequence)
+{
+    // 一轮时长为0的无限循环每步要补上DeltaTime/KINDA_SMALL_NUMBER轮，每轮都调用一遍回调
+    if (Sequence.IsEmpty() || (Sequence.NumLoops == INDEX_NONE && Sequence.GetDuration() <= 0.0f))
+    {
+        return FLerpHandle();
+    }
+
+    WaitForEvaluation();
+    Sequence.Finalize();
+
+    AActor* TimeSource = nullptr;
+    for (FLerpSequenceTrack& Track : Sequence.Tracks)
+    {
+        if (!TimeSource && Track.Component.IsValid())
+        {
+            TimeSource = Track.Component->GetOwner();
+        }
+
+        // 各段逐个求值，曲线同样共用预采样表；逐轴的VectorCurve只对单独的向量tween有效
+        if (Track.Easing.Curve)
+        {
+            Track.Easing.Ease = ELerpEase::Curve;
+            Track.CurveTableIndex = CurveTables.AddFloatCurve(Track.Easing.Curve);
+        }
+        else if (Track.Easing.Ease >= ELerpEase::Curve)
+        {
+            Track.Easing.Ease = ELerpEase::Linear;
+        }
+    }
+
+    // 只有回调的序列时长为0（此时不会无限循环），给一个极小值避免除零
+    const float Duration = FMath::Max(Sequence.GetDuration(), KINDA_SMALL_NUMBER);
+
+    FLerpHandle Handle;
+    const int32 Index = BeginTween(SequenceTweens, ELerpTweenKind::Sequence, FLerpChannelKey(), ELerpConflict::Replace, Duration, ELerpTweenFlags::None, TimeSource, FLerpEasing(), Handle);
+    SequenceTweens.Sequences[Index] = MakeShared<FLerpSequence, ESPMode::NotThreadSafe>(MoveTemp(Sequence));
+    return Handle;
+}
+
+bool ULerpSubsystem::CancelTween(const FLerpHandle& Handle)
+{
+    if (!SlotPool.Find(Handle))
+    {
+        return false;
+    }
+
+    WaitForEvaluation();
+    RemoveTween(Handle.Index, ELerpFinishReason::Cancelled);
+    return true;
+}
+
+bool ULerpSubsystem::PauseTween(const FLerpHandle& Handle)
+{
+    const FLerpSlot* Slot = SlotPool.Find(Handle);
+    if (!Slot)
+    {
+        return false;
+    }
+
+    WaitForEvaluation();
+    FLerpTweenColumns& Tweens = GetColumns(Slot->Kind);
+    EnumAddFlags(Tweens.Flags[Slot->DenseIndex], ELerpTweenFlags::Paused);
+
+    // 本步已经求值但还没写回（异步求值，或在写回中途的回调里暂停）时，这一行本步也不再写回
+    FLerpStepColumns& Step = GetStepColumns(Slot->Kind);
+    if (LerpTweenStep::IsStepRowUnchanged(Tweens, Step, Slot->DenseIndex))
+    {
+        Step.Active[Slot->DenseIndex] = false;
+    }
+    return true;
+}
+
+bool ULerpSubsystem::ResumeTween(const FLerpHandle& Handle)
+{
+    const FLerpSlot* Slot = SlotPool.Find(Handle);
+    if (!Slot)
+    {
+        return false;
+    }
+
+    WaitForEvaluation();
+    EnumRemoveFlags(GetColumns(Slot->Kind).Flags[Slot->DenseIndex], ELerpTweenFlags::Paused);
+    return true;
+}
+
+bool ULerpSubsystem::FinishTween(const FLerpHandle& Handle)
+{
+    const FLerpSlot* Slot = SlotPool.Find(Handle);
+    if (!Slot)
+    {
+        return false;
+    }
+
+    if (EnumHasAnyFlags(GetColumns(Slot->Kind).Flags[Slot->DenseIndex], ELerpTweenFlags::Queued))
+    {
+        return false;
+    }
+
+    WaitForEvaluation();
+    FinishTweenRow(*Slot);
+    return true;
+}
+
+void ULerpSubsystem::FinishTweenRow(const FLerpSlot& Slot)
+{
+    FLerpTweenColumns& Tweens = GetColumns(Slot.Kind);
+    const int32 Index = Slot.DenseIndex;
+    Tweens.Elapsed[Index] = Tweens.Durations[Index];
+    EnumRemoveFlags(Tweens.Flags[Index], ELerpTweenFlags::Paused);
+
+    // 序列直接跳到最后一轮的终点，无限循环的序列在当前这一轮结束
+    if (Slot.Kind == ELerpTweenKind::Sequence)
+    {
+        FLerpSequence& Sequence = *SequenceTweens.Sequences[Index];
+        if (Sequence.NumLoops != INDEX_NONE)
+        {
+            Sequence.CompletedLoops = Sequence.NumLoops - 1;
+        }
+        Sequence.NumLoops = Sequence.CompletedLoops + 1;
+    }
+}
+
+void ULerpSubsystem::SetTweenRelevance(const FLerpHandle& Handle, ELerpRelevance Relevance)
+{
+    const FLerpSlot* Slot = SlotPool.Find(Handle);
+    if (!Slot)
+    {
+        return;
+    }
+
+    if (Relevance == ELerpRelevance::Auto)
+    {
+        const bool bCameraFOV = Slot->Kind == ELerpTweenKind::Scalar && ScalarTweens.Sinks[Slot->DenseIndex] == ELerpScalarSink::CameraFOV;
+        Relevance = bCameraFOV ? ELerpRelevance::Cosmetic : ELerpRelevance::Authoritative;
+    }
+
+    const int32 Mode = Relevance == ELerpRelevance::Cosmetic ? GetHeadlessCosmeticMode() : 0;
+    if (Mode == 0)
+    {
+        return;
+    }
+
+    WaitForEvaluation();
+    if (Mode == 2)
+    {
+        RemoveTween(Handle.Index, ELerpFinishReason::Cancelled);
+    }
+    else
+    {
+        // 只在下一步写一次终点，完成事件和异步节点照常收到Completed
+        FinishTweenRow(*Slot);
+    }
+}
+
+int32 ULerpSubsystem::GetHeadlessCosmeticMode() const
+{
+    const UWorld* World = GetWorld();
+    const bool bHeadless = !FApp::CanEverRender() || (World && World->GetNetMode() == NM_DedicatedServer);
+    return bHeadless ? CVarLerpHeadlessCosmetic.GetValueOnGameThread() : 0;
+}
+
+bool ULerpSubsystem::IsTweenPaused(const FLerpHandle& Handle) const
+{
+    const FLerpSlot* Slot = SlotPool.Find(Handle);
+    return Slot && EnumHasAnyFlags(GetColumns(Slot->Kind).Flags[Slot->DenseIndex], ELerpTweenFlags::Paused);
+}
+
+FLerpTweenColumns& ULerpSubsystem::GetColumns(ELerpTweenKind Kind)
+{
+    switch (Kind)
+    {
+    case ELerpTweenKind::Quat:
+        return QuatTweens;
+    case ELerpTweenKind::Scalar:
+        return ScalarTweens;
+    case ELerpTweenKind::Follow:
+        return FollowTweens;
+    case ELerpTweenKind::Sequence:
+        return SequenceTweens;
+    case ELerpTweenKind::Spring:
+        return SpringTweens;
+    default:
+        check(Kind == ELerpTweenKind::Vector);
+        return VectorTweens;
+    }
+}
+
+const FLerpTweenColumns& ULerpSubsystem::GetColumns(ELerpTweenKind Kind) const
+{
+    return const_cast<ULerpSubsystem*>(this)->GetColumns(Kind);
+}
+
+FLerpStepColumns& ULerpSubsystem::GetStepColumns(ELerpTweenKind Kind)
+{
+    switch (Kind)
+    {
+    case ELerpTweenKind::Quat:
+        return QuatStep;
+    case ELerpTweenKind::Scalar:
+        return ScalarStep;
+    case ELerpTweenKind::Follow:
+        return FollowStep;
+    case ELerpTweenKind::Sequence:
+        return SequenceStep;
+    case ELerpTweenKind::Spring:
+        return SpringStep;
+    default:
+        check(Kind == ELerpTweenKind::Vector);
+        return VectorStep;
+    }
+}
+
+bool ULerpSubsystem::IsTweenActive(const FLerpHandle& Handle) const
+{
+    return SlotPool.Find(Handle) != nullptr;
+}
+
+FDelegateHandle ULerpSubsystem::AddTweenListener(const FLerpHandle& Handle, FOnLerpTweenUpdate OnUpdate, FOnLerpTweenFinished OnFinished)
+{
+    if (!SlotPool.Find(Handle))
+    {
+        return FDelegateHandle();
+    }
+
+    const FDelegateHandle ListenerHandle(FDelegateHandle::GenerateNewHandle);
+    Listeners.Add(Handle.Index, { Handle, ListenerHandle, MoveTemp(OnUpdate), MoveTemp(OnFinished) });
+    return ListenerHandle;
+}
+
+void ULerpSubsystem::RemoveTweenListener(const FLerpHandle& Handle, FDelegateHandle ListenerHandle)
+{
+    for (TMultiMap<int32, FLerpTweenListener>::TKeyIterator It = Listeners.CreateKeyIterator(Handle.Index); It; ++It)
+    {
+        if (It.Value().Handle == Handle && It.Value().ListenerHandle == ListenerHandle)
+        {
+            It.RemoveCurrent();
+            return;
+        }
+    }
+}
+
+const ULerpSubsystem::FLerpTweenListener* ULerpSubsystem::FindTweenListener(const FLerpHandle& Handle, FDelegateHandle ListenerHandle) const
+{
+    for (TMultiMap<int32, FLerpTweenListener>::TConstKeyIterator It = Listeners.CreateConstKeyIterator(Handle.Index); It; ++It)
+    {
+        if (It.Value().Handle == Handle && It.Value().ListenerHandle == ListenerHandle)
+        {
+            return &It.Value();
+        }
+    }
+    return nullptr;
+}
+
+void ULerpSubsystem::SetApplyTickGroup(ETickingGroup TickGroup)
+{
+    // 已注册的tick函数下一次排程时生效
+    ApplyTickFunction.TickGroup = TickGroup;
+}
+
+void ULerpSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    ApplyTickFunction.Target = this;
+    ApplyTickFunction.TickGroup = TG_PostUpdateWork;
+    ApplyTickFunction.bCanEverTick = true;
+    ApplyTickFunction.bStartWithTickEnabled = true;
+    PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &ULerpSubsystem::HandleWorldPreActorTick);
+}
+
+void ULerpSubsystem::Deinitialize()
+{
+    WaitForEvaluation();
+    bStepPending = false;
+    FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+    if (ApplyTickFunction.IsTickFunctionRegistered())
+    {
+        ApplyTickFunction.UnRegisterTickFunction();
+    }
+
+    Super::Deinitialize();
+}
+
+void ULerpSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    ApplyTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void ULerpSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (AsyncFrame == GFrameCounter)
+    {
+        // 写回的tick函数没有执行时（如World尚未BeginPlay）在这里补上
+        ApplyPendingStep();
+    }
+    else
+    {
+        float StepTime;
+        if (ConsumeStepTime(DeltaTime, StepTime))
+        {
+            StepTweens(StepTime);
+            bStepApplied = true;
+        }
+    }
+
+    // 帧间从外部取消的lerp也在这里通知
+    const bool bStepped = bStepApplied;
+    bStepApplied = false;
+    DispatchEvents(bStepped);
+    PublishStats();
+}
+
+bool ULerpSubsystem::ConsumeStepTime(float DeltaTime, float& OutStepTime)
+{
+    if (GetNumActiveLerps() == 0)
+    {
+        PendingDeltaTime = 0.0f;
+        return false;
+    }
+
+    // 降低更新频率时把跳过的时间累计起来一次补上，tween的总时长不变
+    PendingDeltaTime += DeltaTime;
+    if (PendingDeltaTime < CVarLerpUpdateInterval.GetValueOnGameThread())
+    {
+        return false;
+    }
+
+    OutStepTime = PendingDeltaTime;
+    PendingDeltaTime = 0.0f;
+    return true;
+}
+
+void ULerpSubsystem::HandleWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+    if (InWorld != GetWorld() || TickType != LEVELTICK_All || InWorld->IsPaused() || CVarLerpAsyncEvaluation.GetValueOnGameThread() == 0)
+    {
+        return;
+    }
+
+    AsyncFrame = GFrameCounter;
+    float StepTime;
+    if (!ConsumeStepTime(DeltaSeconds, StepTime))
+    {
+        return;
+    }
+
+    // 本步只用这里记下的时间增量，与同步推进的结果相同
+    PrepareStep(StepTime);
+    bStepPending = true;
+    StepTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]
+    {
+        EvaluateStep();
+    });
+}
+
+void ULerpSubsystem::ApplyPendingStep()
+{
+    if (!bStepPending)
+    {
+        return;
+    }
+
+    {
+        LERP_SCOPE_CYCLE_COUNTER(STAT_LerpWaitEvaluate);
+        StepTask.Wait();
+    }
+    StepTask = UE::Tasks::FTask();
+    bStepPending = false;
+    ApplyStep();
+    bStepApplied = true;
+}
+
+void FLerpApplyTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Target)
+    {
+        Target->ApplyPendingStep();
+    }
+}
+
+FString FLerpApplyTickFunction::DiagnosticMessage()
+{
+    return TEXT("FLerpApplyTickFunction");
+}
+
+void ULerpSubsystem::DispatchEvents(bool bStepped)
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpDispatchEvents);
+
+    if (bStepped && Listeners.Num() > 0)
+    {
+        // 先收集再通知，监听里增删lerp不会影响本轮
+        DispatchingUpdates.Reset();
+        for (const TPair<int32, FLerpTweenListener>& Pair : Listeners)
+        {
+            const FLerpSlot* Slot = SlotPool.Find(Pair.Value.Handle);
+            if (!Slot)
+            {
+                continue;
+            }
+
+            const FLerpTweenColumns& Tweens = GetColumns(Slot->Kind);
+            if (!LerpTweenStep::IsWaiting(Tweens, Slot->DenseIndex))
+            {
+                // 弹簧没有固定时长（Durations为FLT_MAX），按约定回报0，停稳时由结束事件通知
+                const float Progress = Slot->Kind == ELerpTweenKind::Spring
+                    ? 0.0f
+                    : FMath::Clamp(Tweens.Elapsed[Slot->DenseIndex] / Tweens.Durations[Slot->DenseIndex], 0.0f, 1.0f);
+                DispatchingUpdates.Add({ Pair.Value.Handle, Pair.Value.ListenerHandle, Progress });
+            }
+        }
+
+        for (const FLerpUpdateEvent& Update : DispatchingUpdates)
+        {
+            // 前面的监听里可能取消了lerp或移除了后面的监听
+            if (const FLerpTweenListener* Listener = FindTweenListener(Update.Handle, Update.ListenerHandle))
+            {
+                const FOnLerpTweenUpdate OnUpdate = Listener->OnUpdate;
+                OnUpdate.ExecuteIfBound(Update.Progress);
+            }
+        }
+    }
+
+    if (PendingFinishEvents.Num() > 0)
+    {
+        Swap(PendingFinishEvents, DispatchingFinishEvents);
+        for (const FLerpFinishEvent& Event : DispatchingFinishEvents)
+        {
+            for (const FOnLerpTweenFinished& OnFinished : Event.OnFinished)
+            {
+                OnFinished.ExecuteIfBound(Event.Reason);
+            }
+            LerpFinished.Broadcast(Event.Handle, Event.Reason);
+        }
+        DispatchingFinishEvents.Reset();
+    }
+}
+
+TStatId ULerpSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(ULerpSubsystem, STATGROUP_Tickables);
+}
+
+void ULerpSubsystem::PublishStats()
+{
+    const int32 NumCompleted = FrameFinishedTweens[static_cast<int32>(ELerpFinishReason::Completed)];
+    const int32 NumCancelled = FrameFinishedTweens[static_cast<int32>(ELerpFinishReason::Cancelled)];
+    const int32 NumReaped = FrameFinishedTweens[static_cast<int32>(ELerpFinishReason::TargetDestroyed)];
+
+    INC_DWORD_STAT_BY(STAT_LerpActiveVector, VectorTweens.Num());
+    INC_DWORD_STAT_BY(STAT_LerpActiveQuat, QuatTweens.Num());
+    INC_DWORD_STAT_BY(STAT_LerpActiveScalar, ScalarTweens.Num());
+    INC_DWORD_STAT_BY(STAT_LerpActiveFollow, FollowTweens.Num());
+    INC_DWORD_STAT_BY(STAT_LerpActiveSequence, SequenceTweens.Num());
+    INC_DWORD_STAT_BY(STAT_LerpActiveSpring, SpringTweens.Num());
+    INC_DWORD_STAT_BY(STAT_LerpSlotPoolUsed, SlotPool.GetNumActive());
+    INC_DWORD_STAT_BY(STAT_LerpSlotPoolCapacity, SlotPool.GetCapacity());
+    INC_DWORD_STAT_BY(STAT_LerpStarted, FrameStartedTweens);
+    INC_DWORD_STAT_BY(STAT_LerpCompleted, NumCompleted);
+    INC_DWORD_STAT_BY(STAT_LerpCancelled, NumCancelled);
+    INC_DWORD_STAT_BY(STAT_LerpReaped, NumReaped);
+
+    TRACE_COUNTER_SET(LerpActiveTweens, SlotPool.GetNumActive());
+    TRACE_COUNTER_SET(LerpSlotPoolCapacity, SlotPool.GetCapacity());
+    TRACE_COUNTER_SET(LerpStartedTweens, FrameStartedTweens);
+    TRACE_COUNTER_SET(LerpCompletedTweens, NumCompleted);
+    TRACE_COUNTER_SET(LerpCancelledTweens, NumCancelled);
+    TRACE_COUNTER_SET(LerpReapedTweens, NumReaped);
+
+    FrameStartedTweens = 0;
+    FMemory::Memzero(FrameFinishedTweens);
+}
+
+void ULerpSubsystem::StepTweens(float DeltaTime)
+{
+    PrepareStep(DeltaTime);
+    EvaluateStep();
+    ApplyStep();
+}
+
+void ULerpSubsystem::PrepareStep(float DeltaTime)
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpPrepare);
+
+    StepParallelThreshold = CVarLerpParallelThreshold.GetValueOnGameThread();
+    StepNlerpMaxAngle = CVarLerpNlerpMaxAngle.GetValueOnGameThread();
+
+    ++StepIndex;
+    ActivateQueuedTweens();
+    SocketCache.BeginStep();
+    UpdateStrides(DeltaTime);
+
+    PrepareVectorTweens(DeltaTime);
+    PrepareQuatTweens(DeltaTime);
+    PrepareScalarTweens(DeltaTime);
+    PrepareFollowTweens(DeltaTime);
+    PrepareSequenceTweens(DeltaTime);
+    PrepareSpringTweens(DeltaTime);
+}
+
+void ULerpSubsystem::EvaluateStep()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpEvaluate);
+
+    EvaluateVectorTweens();
+    EvaluateQuatTweens();
+    EvaluateScalarTweens();
+    AdvanceTweens(FollowTweens, FollowStep);
+    AdvanceTweens(SequenceTweens, SequenceStep);
+    EvaluateSpringTweens();
+}
+
+void ULerpSubsystem::ApplyStep()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpApply);
+
+    ApplyVectorTweens();
+    ApplyQuatTweens();
+    ApplyScalarTweens();
+    ApplyFollowTweens();
+    ApplySequenceTweens();
+    ApplySpringTweens();
+
+    // 同一组件的位置/旋转/缩放合并成一次写入
+    {
+        LERP_SCOPE_CYCLE_COUNTER(STAT_LerpFlush);
+        TransformBatch.Flush();
+    }
+}
+
+// 各种tween分三段：整理（游戏线程）-> 整批SIMD推进和插值（可在后台）-> 逐行写回（游戏线程）。
+// 整理和写回都倒序遍历：删除的行被末尾行替换，而末尾行本步已经处理过。
+// 整理时回收目标已被销毁的行（包括暂停和排队中的），带CaptureStart的行先读回当前值作为起点；
+// 写回时跳过暂停和排队中的行，以及整理之后被挪动或新加入的行
+
+void ULerpSubsystem::PrepareVectorTweens(float DeltaTime)
+{
+    for (int32 Index = VectorTweens.Num() - 1; Index >= 0; --Index)
+    {
+        USceneComponent* Component = VectorTweens.Components[Index].Get();
+        if (!Component)
+        {
+            ReapTweenRow(VectorTweens, Index);
+            continue;
+        }
+        if (LerpTweenStep::IsWaiting(VectorTweens, Index))
+        {
+            continue;
+        }
+
+        if (ConsumeReadCurrent(VectorTweens, Index))
+        {
+            VectorTweens.Starts[Index] = ReadVectorChannel(Component, VectorTweens.Channels[Index]);
+        }
+    }
+
+    GatherStep(VectorTweens, VectorStep, DeltaTime);
+}
+
+void ULerpSubsystem::EvaluateVectorTweens()
+{
+    const int32 NumTweens = VectorStep.Num();
+    AdvanceTweens(VectorTweens, VectorStep);
+    StepVectors.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+    LerpTweenStep::ForEachStepChunk(NumTweens, LerpTweenStep::GetNumStepChunks(NumTweens, StepParallelThreshold), [this](int32 Chunk, int32 Start, int32 Count)
+    {
+        const float* Alphas = VectorStep.Alphas.GetData();
+        LerpBatchKernels::LerpVectors(VectorTweens.Starts.GetData() + Start, VectorTweens.Ends.GetData() + Start, Alphas + Start, StepVectors.GetData() + Start, Count);
+
+        // 逐轴缓动的行：Alphas保持线性进度，按轴查表后重算
+        if (NumVectorCurveTweens > 0)
+        {
+            for (int32 Index = Start; Index < Start + Count; ++Index)
+            {
+                if (VectorTweens.Eases[Index] == ELerpEase::VectorCurve)
+                {
+                    const FVector AxisAlphas = CurveTables.GetSamples().EvaluateVector(VectorTweens.CurveTableIndices[Index], Alphas[Index]);
+                    StepVectors[Index] = VectorTweens.Starts[Index] + (VectorTweens.Ends[Index] - VectorTweens.Starts[Index]) * AxisAlphas;
+                }
+            }
+        }
+    });
+}
+
+void ULerpSubsystem::ApplyVectorTweens()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpApplyVector);
+
+    for (int32 Index = VectorStep.Num() - 1; Index >= 0; --Index)
+    {
+        if (!LerpTweenStep::IsStepRowUnchanged(VectorTweens, VectorStep, Index) || !VectorStep.Active[Index])
+        {
+            continue;
+        }
+
+        USceneComponent* Component = VectorTweens.Components[Index].Get();
+        if (!Component)
+        {
+            continue;
+        }
+
+        const FVector& NewValue = StepVectors[Index];
+        switch (VectorTweens.Channels[Index])
+        {
+        case ELerpVectorChannel::WorldLocation:
+            TransformBatch.SetLocation(Component, false, NewValue);
+            break;
+        case ELerpVectorChannel::RelativeLocation:
+            TransformBatch.SetLocation(Component, true, NewValue);
+            break;
+        case ELerpVectorChannel::WorldScale:
+            TransformBatch.SetScale(Component, false, NewValue);
+            break;
+        }
+
+        // 从当前值出发的tween到达目标即可提前结束
+        const bool bFromCurrent = EnumHasAnyFlags(VectorTweens.Flags[Index], ELerpTweenFlags::FromCurrent);
+        if (VectorStep.Finished[Index] || (bFromCurrent && FVector::Dist(NewValue, VectorTweens.Ends[Index]) <= KINDA_SMALL_NUMBER))
+        {
+            RemoveTweenRow(VectorTweens, Index, ELerpFinishReason::Completed);
+        }
+    }
+}
+
+void ULerpSubsystem::PrepareQuatTweens(float DeltaTime)
+{
+    for (int32 Index = QuatTweens.Num() - 1; Index >= 0; --Index)
+    {
+        USceneComponent* Component = QuatTweens.Components[Index].Get();
+        if (!Component)
+        {
+            ReapTweenRow(QuatTweens, Index);
+            continue;
+        }
+        if (LerpTweenStep::IsWaiting(QuatTweens, Index))
+        {
+            continue;
+        }
+
+        if (ConsumeReadCurrent(QuatTweens, Index))
+        {
+            QuatTweens.Starts[Index] = ReadRotationChannel(Component, QuatTweens.Channels[Index]);
+        }
+    }
+
+    GatherStep(QuatTweens, QuatStep, DeltaTime);
+}
+
+void ULerpSubsystem::EvaluateQuatTweens()
+{
+    const int32 NumTweens = QuatStep.Num();
+    AdvanceTweens(QuatTweens, QuatStep);
+    StepQuats.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+    LerpTweenStep::ForEachStepChunk(NumTweens, LerpTweenStep::GetNumStepChunks(NumTweens, StepParallelThreshold), [this](int32 Chunk, int32 Start, int32 Count)
+    {
+        LerpBatchKernels::SlerpQuats(QuatTweens.Starts.GetData() + Start, QuatTweens.Ends.GetData() + Start, QuatStep.Alphas.GetData() + Start, StepQuats.GetData() + Start, Count, StepNlerpMaxAngle);
+    });
+}
+
+void ULerpSubsystem::ApplyQuatTweens()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpApplyQuat);
+
+    for (int32 Index = QuatStep.Num() - 1; Index >= 0; --Index)
+    {
+        if (!LerpTweenStep::IsStepRowUnchanged(QuatTweens, QuatStep, Index) || !QuatStep.Active[Index])
+        {
+            continue;
+        }
+
+        USceneComponent* Component = QuatTweens.Components[Index].Get();
+        if (!Component)
+        {
+            continue;
+        }
+
+        // 只有从当前值出发的tween到达目标才提前结束。缓动曲线（Elastic、Back、Bounce）会在中途越过终点，不能据此判断
+        const FQuat& NewRotation = StepQuats[Index];
+        const bool bFromCurrent = EnumHasAnyFlags(QuatTweens.Flags[Index], ELerpTweenFlags::FromCurrent);
+        const bool bFinished = QuatStep.Finished[Index] || (bFromCurrent && FQuat::ErrorAutoNormalize(QuatTweens.Ends[Index], NewRotation) <= KINDA_SMALL_NUMBER);
+
+        // 结束时写入终点本身，不留插值的舍入误差
+        TransformBatch.SetRotation(Component, QuatTweens.Channels[Index] == ELerpRotationChannel::Relative, bFinished ? QuatTweens.Ends[Index] : NewRotation);
+
+        if (bFinished)
+        {
+            RemoveTweenRow(QuatTweens, Index, ELerpFinishReason::Completed);
+        }
+    }
+}
+
+void ULerpSubsystem::PrepareScalarTweens(float DeltaTime)
+{
+    for (int32 Index = ScalarTweens.Num() - 1; Index >= 0; --Index)
+    {
+        if (!IsScalarSinkAlive(ScalarTweens, Index))
+        {
+            ReapTweenRow(ScalarTweens, Index);
+            continue;
+        }
+        if (LerpTweenStep::IsWaiting(ScalarTweens, Index))
+        {
+            continue;
+        }
+
+        if (ConsumeReadCurrent(ScalarTweens, Index))
+        {
+            // 委托和lambda读不回当前值，沿用原起点
+            switch (ScalarTweens.Sinks[Index])
+            {
+            case ELerpScalarSink::CameraFOV:
+                ScalarTweens.Starts[Index] = ScalarTweens.Cameras[Index]->FieldOfView;
+                break;
+            case ELerpScalarSink::FloatPointer:
+                ScalarTweens.Starts[Index] = *ScalarTweens.ValuePtrs[Index];
+                break;
+            case ELerpScalarSink::Property:
+                ScalarTweens.Starts[Index] = static_cast<float>(ScalarTweens.Properties[Index]->GetFloatingPointPropertyValue(ScalarTweens.PropertyAddresses[Index]));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    GatherStep(ScalarTweens, ScalarStep, DeltaTime);
+}
+
+void ULerpSubsystem::EvaluateScalarTweens()
+{
+    const int32 NumTweens = ScalarStep.Num();
+    AdvanceTweens(ScalarTweens, ScalarStep);
+    StepScalars.SetNumUninitialized(NumTweens, EAllowShrinking::No);
+    LerpTweenStep::ForEachStepChunk(NumTweens, LerpTweenStep::GetNumStepChunks(NumTweens, StepParallelThreshold), [this](int32 Chunk, int32 Start, int32 Count)
+    {
+        LerpBatchKernels::LerpFloats(ScalarTweens.Starts.GetData() + Start, ScalarTweens.Ends.GetData() + Start, ScalarStep.Alphas.GetData() + Start, StepScalars.GetData() + Start, Count);
+    });
+}
+
+void ULerpSubsystem::ApplyScalarTweens()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpApplyScalar);
+
+    // 委托和lambda里可能取消或启动lerp，行会被挪动，每次调用后重新核对槽位
+    for (int32 Index = ScalarStep.Num() - 1; Index >= 0; --Index)
+    {
+        if (!LerpTweenStep::IsStepRowUnchanged(ScalarTweens, ScalarStep, Index) || !ScalarStep.Active[Index] || !IsScalarSinkAlive(ScalarTweens, Index))
+        {
+            continue;
+        }
+
+        const float NewValue = StepScalars[Index];
+        switch (ScalarTweens.Sinks[Index])
+        {
+        case ELerpScalarSink::CameraFOV:
+            ScalarTweens.Cameras[Index]->SetFieldOfView(NewValue);
+            break;
+        case ELerpScalarSink::FloatPointer:
+            *ScalarTweens.ValuePtrs[Index] = NewValue;
+            break;
+        case ELerpScalarSink::Property:
+            ScalarTweens.Properties[Index]->SetFloatingPointPropertyValue(ScalarTweens.PropertyAddresses[Index], static_cast<double>(NewValue));
+            break;
+        case ELerpScalarSink::Setter:
+        {
+            const FLerpFloatSetter Setter = ScalarTweens.Setters[Index];
+            Setter.ExecuteIfBound(NewValue);
+            break;
+        }
+        case ELerpScalarSink::Callback:
+        {
+            const TSharedPtr<TFunction<void(float)>, ESPMode::NotThreadSafe> Callback = ScalarTweens.Callbacks[Index];
+            (*Callback)(NewValue);
+            break;
+        }
+        }
+
+        if (LerpTweenStep::IsStepRowUnchanged(ScalarTweens, ScalarStep, Index) && ScalarStep.Finished[Index])
+        {
+            RemoveTweenRow(ScalarTweens, Index, ELerpFinishReason::Completed);
+        }
+    }
+}
+
+void ULerpSubsystem::PrepareFollowTweens(float DeltaTime)
+{
+    for (int32 Index = FollowTweens.Num() - 1; Index >= 0; --Index)
+    {
+        USceneComponent* Component = FollowTweens.Components[Index].Get();
+        if (!Component || !SocketCache.IsAlive(FollowTweens.SocketTargets[Index]))
+        {
+            ReapTweenRow(FollowTweens, Index);
+            continue;
+        }
+        if (LerpTweenStep::IsWaiting(FollowTweens, Index))
+        {
+            continue;
+        }
+
+        if (ConsumeReadCurrent(FollowTweens, Index))
+        {
+            FollowTweens.Starts[Index] = Component->GetComponentLocation();
+        }
+    }
+
+    GatherStep(FollowTweens, FollowStep, DeltaTime);
+}
+
+void ULerpSubsystem::ApplyFollowTweens()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpApplyFollow);
+
+    for (int32 Index = FollowStep.Num() - 1; Index >= 0; --Index)
+    {
+        if (!LerpTweenStep::IsStepRowUnchanged(FollowTweens, FollowStep, Index) || !FollowStep.Active[Index])
+        {
+            continue;
+        }
+
+        USceneComponent* Component = FollowTweens.Components[Index].Get();
+        if (!Component || !SocketCache.IsAlive(FollowTweens.SocketTargets[Index]))
+        {
+            continue;
+        }
+
+        // 目标随Socket移动，写回时才取；跟随同一Socket的tween共用一次求值
+        const FVector TargetLocation = SocketCache.GetLocation(FollowTweens.SocketTargets[Index]);
+
+        const FVector NewLocation = FMath::Lerp(FollowTweens.Starts[Index], TargetLocation, FollowStep.Alphas[Index]);
+        TransformBatch.SetLocation(Component, false, NewLocation);
+
+        if (FollowStep.Finished[Index] || FVector::Dist(NewLocation, TargetLocation) <= KINDA_SMALL_NUMBER)
+        {
+            RemoveTweenRow(FollowTweens, Index, ELerpFinishReason::Completed);
+        }
+    }
+}
+
+void ULerpSubsystem::PrepareSequenceTweens(float DeltaTime)
+{
+    for (int32 Index = SequenceTweens.Num() - 1; Index >= 0; --Index)
+    {
+        if (!SequenceTweens.Sequences[Index]->HasLiveTargets())
+        {
+            ReapTweenRow(SequenceTweens, Index);
+        }
+    }
+
+    GatherStep(SequenceTweens, SequenceStep, DeltaTime);
+}
+
+void ULerpSubsystem::ApplySequenceTweens()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpApplySequence);
+
+    for (int32 Index = SequenceStep.Num() - 1; Index >= 0; --Index)
+    {
+        if (!LerpTweenStep::IsStepRowUnchanged(SequenceTweens, SequenceStep, Index) || !SequenceStep.Active[Index])
+        {
+            continue;
+        }
+
+        // 回调里可能取消或启动lerp使本行被挪动，每次回调后经槽位重新找到本行
+        const int32 SlotIndex = SequenceStep.Slots[Index];
+        const TSharedPtr<FLerpSequence, ESPMode::NotThreadSafe> Sequence = SequenceTweens.Sequences[Index];
+        const float Length = SequenceTweens.Durations[Index];
+
+        // 一步跨过一轮或多轮时逐轮补上，每轮的回调和各段的终点都不会被跳过
+        bool bAlive = true;
+        while (bAlive && SequenceTweens.Elapsed[SlotPool[SlotIndex].DenseIndex] >= Length && !Sequence->IsLastLoop())
+        {
+            bAlive = EvaluateSequenceSpan(*Sequence, Sequence->IsReversed() ? 0.0f : Length);
+            if (bAlive)
+            {
+                SequenceTweens.Elapsed[SlotPool[SlotIndex].DenseIndex] -= Length;
+                ++Sequence->CompletedLoops;
+                // 往返播放从这一端接着走；否则回到开头，开头的回调再触发一次
+                if (!Sequence->bPingPong)
+                {
+                    Sequence->PreviousTime = -1.0f;
+                }
+            }
+        }
+        if (!bAlive)
+        {
+            continue;
+        }
+
+        const float LoopTime = FMath::Min(SequenceTweens.Elapsed[SlotPool[SlotIndex].DenseIndex], Length);
+        if (EvaluateSequenceSpan(*Sequence, Sequence->IsReversed() ? Length - LoopTime : LoopTime)
+            && LerpTweenStep::IsTweenFinished(SequenceTweens, SlotPool[SlotIndex].DenseIndex))
+        {
+            RemoveTweenRow(SequenceTweens, SlotPool[SlotIndex].DenseIndex, ELerpFinishReason::Completed);
+        }
+    }
+}
+
+bool ULerpSubsystem::EvaluateSequenceSpan(FLerpSequence& Sequence, float To)
+{
+    const float From = Sequence.PreviousTime;
+    Sequence.PreviousTime = To;
+
+    // 倒放时按开始时间逆序处理，同一属性上时间靠后的段先写、靠前的段后写
+    const bool bForward = To >= From;
+    const float SpanMin = FMath::Min(From, To);
+    const float SpanMax = FMath::Max(From, To);
+    const int32 NumTracks = Sequence.Tracks.Num();
+
+    for (int32 Step = 0; Step < NumTracks; ++Step)
+    {
+        FLerpSequenceTrack& Track = Sequence.Tracks[bForward ? Step : NumTracks - 1 - Step];
+
+        if (Track.Type == ELerpSequenceTrackType::Callback)
+        {
+            // 正放经过(From, To]、倒放经过[To, From)内的时间点时调用
+            const bool bReached = bForward
+                ? Track.StartTime > From && Track.StartTime <= To
+                : Track.StartTime >= To && Track.StartTime < From;
+            if (bReached)
+            {
+                Track.OnReached();
+                if (Sequence.bRemoved)
+                {
+                    return false;
+                }
+            }
+            continue;
+        }
+
+        // 只写本步经过的段；整段被跨过时也要写到它的终点
+        if (Track.StartTime + Track.Duration < SpanMin || Track.StartTime > SpanMax)
+        {
+            continue;
+        }
+
+        const float LinearAlpha = Track.Duration > 0.0f
+            ? FMath::Clamp((To - Track.StartTime) / Track.Duration, 0.0f, 1.0f)
+            : (To >= Track.StartTime ? 1.0f : 0.0f);
+        const float Alpha = LerpEasing::EvaluateEase(Track.Easing.Ease, Track.CurveTableIndex, CurveTables.GetSamples(), LinearAlpha);
+
+        USceneComponent* Component = Track.Component.Get();
+        switch (Track.Type)
+        {
+        case ELerpSequenceTrackType::Vector:
+        {
+            if (!Component)
+            {
+                break;
+            }
+            if (Track.bCaptureStart)
+            {
+                Track.VectorStart = ReadVectorChannel(Component, Track.VectorChannel);
+                Track.bCaptureStart = false;
+            }
+
+            const FVector NewValue = FMath::Lerp(Track.VectorStart, Track.VectorEnd, Alpha);
+            if (Track.VectorChannel == ELerpVectorChannel::WorldScale)
+            {
+                TransformBatch.SetScale(Component, false, NewValue);
+            }
+            else
+            {
+                TransformBatch.SetLocation(Component, Track.VectorChannel == ELerpVectorChannel::RelativeLocation, NewValue);
+            }
+            break;
+        }
+        case ELerpSequenceTrackType::Quat:
+            if (!Component)
+            {
+                break;
+            }
+            if (Track.bCaptureStart)
+            {
+                Track.QuatStart = ReadRotationChannel(Component, Track.RotationChannel);
+                Track.bCaptureStart = false;
+            }
+            TransformBatch.SetRotation(Component, Track.RotationChannel == ELerpRotationChannel::Relative, FQuat::Slerp(Track.QuatStart, Track.QuatEnd, Alpha));
+            break;
+        case ELerpSequenceTrackType::Scalar:
+            Track.OnValue(FMath::Lerp(Track.ScalarStart, Track.ScalarEnd, Alpha));
+            if (Sequence.bRemoved)
+            {
+                return false;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+void ULerpSubsystem::PrepareSpringTweens(float DeltaTime)
+{
+    for (int32 Index = SpringTweens.Num() - 1; Index >= 0; --Index)
+    {
+        USceneComponent* Component = SpringTweens.Components[Index].Get();
+        const int32 SocketTarget = SpringTweens.SocketTargets[Index];
+        if (!Component || (SocketTarget != INDEX_NONE && !SocketCache.IsAlive(SocketTarget)))
+        {
+            ReapTweenRow(SpringTweens, Index);
+            continue;
+        }
+        if (LerpTweenStep::IsWaiting(SpringTweens, Index))
+        {
+            continue;
+        }
+
+        if (ConsumeReadCurrent(SpringTweens, Index))
+        {
+            SpringTweens.Positions[Index] = ReadVectorChannel(Component, SpringTweens.Channels[Index]);
+        }
+
+        // 求值可能在后台进行，Socket位置在这里先取好
+        if (SocketTarget != INDEX_NONE)
+        {
+            SpringTweens.Targets[Index] = SocketCache.GetLocation(SocketTarget);
+        }
+    }
+
+    GatherStep(SpringTweens, SpringStep, DeltaTime);
+}
+
+void ULerpSubsystem::EvaluateSpringTweens()
+{
+    const int32 NumTweens = SpringStep.Num();
+    LerpTweenStep::ForEachStepChunk(NumTweens, LerpTweenStep::GetNumStepChunks(NumTweens, StepParallelThreshold), [this](int32 Chunk, int32 Start, int32 Count)
+    {
+        LerpBatchKernels::SmoothDampVectors(SpringTweens.Positions.GetData() + Start, SpringTweens.Velocities.GetData() + Start, SpringTweens.Targets.GetData() + Start,
+            SpringTweens.SmoothTimes.GetData() + Start, SpringStep.Deltas.GetData() + Start, Count);
+    });
+}
+
+void ULerpSubsystem::ApplySpringTweens()
+{
+    LERP_SCOPE_CYCLE_COUNTER(STAT_LerpApplySpring);
+
+    for (int32 Index = SpringStep.Num() - 1; Index >= 0; --Index)
+    {
+        if (!LerpTweenStep::IsStepRowUnchanged(SpringTweens, SpringStep, Index) || !SpringStep.Active[Index])
+        {
+            continue;
+        }
+
+        USceneComponent* Component = SpringTweens.Components[Index].Get();
+        if (!Component)
+        {
+            continue;
+        }
+
+        // 固定目标停稳时，或被FinishTween时，直接落到目标上
+        const FVector& Target = SpringTweens.Targets[Index];
+        const bool bSettled = SpringTweens.SocketTargets[Index] == INDEX_NONE
+            && FVector::Dist(SpringTweens.Positions[Index], Target) <= SpringSettleTolerance
+            && SpringTweens.Velocities[Index].Size() <= SpringSettleTolerance;
+        const bool bFinished = bSettled || LerpTweenStep::IsTweenFinished(SpringTweens, Index);
+        const FVector& NewValue = bFinished ? Target : SpringTweens.Positions[Index];
+
+        switch (SpringTweens.Channels[Index])
+        {
+        case ELerpVectorChannel::WorldLocation:
+            TransformBatch.SetLocation(Component, false, NewValue);
+            break;
+        case ELerpVectorChannel::RelativeLocation:
+            TransformBatch.SetLocation(Component, true, NewValue);
+            break;
+        case ELerpVectorChannel::WorldScale:
+            TransformBatch.SetScale(Component, false, NewValue);
+            break;
+        }
+
+        if (bFinished)
+        {
+            RemoveTweenRow(SpringTweens, Index, ELerpFinishReason::Completed);
+        }
+    }
+}
@@ -0,0 +1,407 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Tasks/Task.h"
+#include "LerpTweenStorage.h"
+#include "LerpCore/LerpCoreStep.h"
+#include "LerpTransformBatch.h"
+#include "LerpEasing.h"
+#include "LerpSocketCache.h"
+#include "LerpSequence.h"
+#include "LerpSubsystem.generated.h"
+
+class USceneComponent;
+class UCameraComponent;
+class ULerpSubsystem;
+
+// 任意lerp结束时广播
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnLerpFinished, const FLerpHandle& /*Handle*/, ELerpFinishReason /*Reason*/);
+
+// 单个lerp的监听：每次推进后回报线性进度(0~1)，结束时回报原因。弹簧没有固定时长，进度总是0
+DECLARE_DELEGATE_OneParam(FOnLerpTweenUpdate, float /*Progress*/);
+DECLARE_DELEGATE_OneParam(FOnLerpTweenFinished, ELerpFinishReason /*Reason*/);
+
+// Lerp.AsyncEvaluation开启时，在指定的TickGroup把帧初启动的求值结果写回组件
+USTRUCT()
+struct LUXUN2024_API FLerpApplyTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    ULerpSubsystem* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FLerpApplyTickFunction> : public TStructOpsTypeTraitsBase2<FLerpApplyTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
+// 每个World一个的lerp调度器：按种类把tween存进连续数组，每帧统一推进一次
+UCLASS()
+class LUXUN2024_API ULerpSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // 从任意WorldContextObject取到所在World的子系统
+    static ULerpSubsystem* Get(const UObject* WorldContextObject);
+
+    // 以下Add*在同一(目标, 通道)已有lerp时按Conflict处理
+    FLerpHandle AddVectorTween(USceneComponent* Component, ELerpVectorChannel Channel, const FVector& Start, const FVector& End, float Duration, ELerpTweenFlags Flags = ELerpTweenFlags::None, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    // 批量启动向量tween，Components与Ends一一对应；Durations、Delays只有一个元素时全部共用，Delays为空表示不延迟。
+    // 起点在各自开始推进时读回，延迟期间不写目标。列和槽位池只预留一次，比逐个调用AddVectorTween省去反复扩容。
+    // OutHandles与Components一一对应，目标为空或时长不大于0的为无效句柄；数组长度对不上时全部无效
+    void AddVectorTweens(const TArray<USceneComponent*>& Components, ELerpVectorChannel Channel, const TArray<FVector>& Ends, const TArray<float>& Durations, const TArray<float>& Delays, ELerpConflict Conflict, const FLerpEasing& Easing, TArray<FLerpHandle>& OutHandles);
+
+    FLerpHandle AddQuatTween(USceneComponent* Component, ELerpRotationChannel Channel, const FQuat& Start, const FQuat& End, float Duration, ELerpTweenFlags Flags = ELerpTweenFlags::None, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    FLerpHandle AddCameraFOVTween(UCameraComponent* Camera, float StartFOV, float EndFOV, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    FLerpHandle AddFloatTween(UObject* WorldContextObject, float* ValuePtr, float TargetValue, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    // 写入Target上的float/double属性，路径可穿过结构体成员（如"Settings.Volume"）。找不到属性时返回无效句柄
+    FLerpHandle AddPropertyTween(UObject* Target, const FString& PropertyPath, float TargetValue, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    // 以下两种写入目标无法读回当前值，由调用方给出起点，Blend改写时也仍从Start出发
+    // 以(绑定的对象, 函数名)为通道，委托绑定的对象销毁后自动回收
+    FLerpHandle AddSetterTween(const FLerpFloatSetter& Setter, float Start, float End, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    // 以(Owner, ChannelName)为通道，ChannelName为None或Owner为空时不参与冲突处理。
+    // Owner非空时随Owner一起回收，为空则由调用方保证lambda捕获的对象存活
+    FLerpHandle AddCallbackTween(UObject* Owner, FName ChannelName, float Start, float End, float Duration, TFunction<void(float)> Callback, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    FLerpHandle AddFollowTween(USceneComponent* Component, USceneComponent* SocketParent, FName SocketName, const FVector& Start, float Duration, ELerpConflict Conflict = ELerpConflict::Replace, const FLerpEasing& Easing = FLerpEasing());
+
+    // 临界阻尼弹簧：带着速度追向Target，轨迹与帧率和Lerp.UpdateInterval无关，停稳后结束。
+    // SmoothTime约为追上目标所需的时间。Blend改写已有的弹簧时保留速度
+    FLerpHandle AddSpringTween(USceneComponent* Component, ELerpVectorChannel Channel, const FVector& Target, float SmoothTime, ELerpConflict Conflict = ELerpConflict::Blend);
+
+    // 弹簧追向SocketParent上的Socket（世界位置），每步重新取目标，直到取消或任一组件被销毁
+    FLerpHandle AddSpringFollowTween(USceneComponent* Component, USceneComponent* SocketParent, FName SocketName, float SmoothTime, ELerpConflict Conflict = ELerpConflict::Blend);
+
+    // 改变弹簧的目标，速度保持连续。跟随Socket的弹簧改为追向固定目标
+    bool SetSpringTarget(const FLerpHandle& Handle, const FVector& Target);
+
+    // 整条序列只占一个句柄，可整体暂停、取消或直接完成。序列不参与通道冲突处理。
+    // 空序列和一轮时长为0的无限循环返回无效句柄
+    FLerpHandle AddSequence(FLerpSequence Sequence);
+
+    // 立即停止，不再写回。排在其后的同通道lerp随即开始
+    bool CancelTween(const FLerpHandle& Handle);
+
+    bool PauseTween(const FLerpHandle& Handle);
+
+    bool ResumeTween(const FLerpHandle& Handle);
+
+    // 下一次推进时直接写入终点并结束。排队中的lerp不能直接完成
+    bool FinishTween(const FLerpHandle& Handle);
+
+    bool IsTweenPaused(const FLerpHandle& Handle) const;
+
+    // 标记lerp是否只影响表现。专用服务器和无法渲染的进程里，表现类lerp在下一步直接写入终点并结束，
+    // 或按Lerp.HeadlessCosmetic直接丢弃（作为取消）。相机FOV在启动时已按Auto处理过
+    void SetTweenRelevance(const FLerpHandle& Handle, ELerpRelevance Relevance);
+
+    // 句柄对应的tween是否仍在进行（已完成或槽位已被复用都返回false）
+    bool IsTweenActive(const FLerpHandle& Handle) const;
+
+    // 所有事件都在本帧推进结束后统一派发，推进过程中不会调用任何外部代码（序列、Setter等自身的回调除外）
+    FOnLerpFinished& OnLerpFinished() { return LerpFinished; }
+
+    // 监听单个lerp，结束后自动移除。同一句柄可以有多个监听，各自都会收到通知。句柄已失效时返回无效的FDelegateHandle
+    FDelegateHandle AddTweenListener(const FLerpHandle& Handle, FOnLerpTweenUpdate OnUpdate, FOnLerpTweenFinished OnFinished);
+
+    // 只移除AddTweenListener返回的那一个监听，同一句柄上的其他监听不受影响
+    void RemoveTweenListener(const FLerpHandle& Handle, FDelegateHandle ListenerHandle);
+
+    int32 GetNumActiveLerps() const { return SlotPool.GetNumActive(); }
+
+    // 槽位池大小（历史峰值），用于观察稳态下是否还在增长
+    int32 GetSlotPoolCapacity() const { return SlotPool.GetCapacity(); }
+
+    // 因目标被销毁而被回收的tween累计数
+    int32 GetNumReapedLerps() const { return NumReapedTweens; }
+
+    // 预采样曲线表的数量和占用的内存（字节），同一曲线资产只占一张表
+    int32 GetNumCurveTables() const { return CurveTables.Num(); }
+    SIZE_T GetCurveTableMemory() const { return CurveTables.GetAllocatedSize(); }
+
+    // 按目标Actor决定其tween每几步推进一次（1为每步），替代内置的按是否被渲染（Lerp.HiddenStride）
+    // 和离视点的距离（Lerp.FarStride）判断。每Lerp.SignificanceInterval秒对每个Actor调用一次，传空函数恢复内置判断。
+    // 降频的tween跳过的时间在轮到时一次补上，最后一步不会被跳过，仍按时结束并写入终点
+    void SetSignificanceFunction(TFunction<int32(const AActor* Target)> Function);
+
+    // 异步求值时写回组件的时机，默认TG_PostUpdateWork。所有种类的tween在同一时机写回
+    void SetApplyTickGroup(ETickingGroup TickGroup);
+    ETickingGroup GetApplyTickGroup() const { return ApplyTickFunction.TickGroup; }
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    friend struct FLerpApplyTickFunction;
+
+    // 以实际经过的时间推进全部tween：整理 -> 求值 -> 写回
+    void StepTweens(float DeltaTime);
+
+    // 累计帧时间，达到Lerp.UpdateInterval时取出本步要推进的时间
+    bool ConsumeStepTime(float DeltaTime, float& OutStepTime);
+
+    // 游戏线程：回收失效的行、读回当前值，并记下每行本步的时间增量
+    void PrepareStep(float DeltaTime);
+
+    // 只读写tween的数值列和本步的临时列，不碰UObject，可以放到后台执行
+    void EvaluateStep();
+
+    // 游戏线程：写回组件、调用回调并删除完成的行
+    void ApplyStep();
+
+    // 异步模式：在World开始Tick Actor之前整理本步并把求值放到后台
+    void HandleWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+    // 异步模式：等待后台求值并写回，本帧没有待写回的步时什么都不做
+    void ApplyPendingStep();
+
+    // 后台求值期间tween的列不能增删改，修改前先等它完成
+    void WaitForEvaluation()
+    {
+        if (bStepPending)
+        {
+            StepTask.Wait();
+        }
+    }
+
+    // 按通道登记表处理冲突后，返回要填写的行：新追加的行，或Blend时被就地改写的行。
+    // ChannelKey的Target为空时不登记通道
+    template <typename TweensType>
+    int32 BeginTween(TweensType& Tweens, ELerpTweenKind Kind, const FLerpChannelKey& ChannelKey, ELerpConflict Conflict, float Duration, ELerpTweenFlags Flags, AActor* TimeSource, const FLerpEasing& Easing, FLerpHandle& OutHandle);
+
+    // 设置行的缓动，替换掉该行原先引用的曲线表
+    void SetTweenEasing(FLerpTweenColumns& Tweens, int32 Index, const FLerpEasing& Easing);
+
+    // 释放该行对曲线表的引用
+    void ReleaseTweenCurve(FLerpTweenColumns& Tweens, int32 Index);
+
+    // 记下本步的槽位和每行的时间增量，暂停、排队中和降频跳过的行为0
+    void GatherStep(FLerpTweenColumns& Tweens, FLerpStepColumns& Step, float DeltaTime);
+
+    // 每隔Lerp.SignificanceInterval按目标的重要度重新设置各行的Strides
+    void UpdateStrides(float DeltaTime);
+
+    // 整批推进一种tween：Step.Alphas得到缓动后的Alpha。
+    // 行数达到Lerp.ParallelThreshold时分块在工作线程上计算
+    void AdvanceTweens(FLerpTweenColumns& Tweens, FLerpStepColumns& Step);
+
+    // 追加一行并分配槽位
+    template <typename TweensType>
+    int32 AddTweenRow(TweensType& Tweens, ELerpTweenKind Kind, float Duration, ELerpTweenFlags Flags, AActor* TimeSource, FLerpHandle& OutHandle);
+
+    // 删除一行并回收其槽位，同时修正被挪过来的行的槽位。有人关心时记下结束事件
+    template <typename TweensType>
+    void RemoveTweenRow(TweensType& Tweens, int32 Index, ELerpFinishReason Reason);
+
+    // 目标已失效的行：计数后直接删除
+    template <typename TweensType>
+    void ReapTweenRow(TweensType& Tweens, int32 Index);
+
+    // 按槽位删除任意种类的tween
+    void RemoveTween(int32 SlotIndex, ELerpFinishReason Reason);
+
+    // 让该行在下一次推进时写入终点并结束，排队中的行轮到时立即结束
+    void FinishTweenRow(const FLerpSlot& Slot);
+
+    // 本进程对表现类lerp的处理：0照常推进，1直接完成，2丢弃
+    int32 GetHeadlessCosmeticMode() const;
+
+    // 取消某通道上正在进行的以及排队中的全部tween
+    void CancelChannel(const FLerpChannelKey& ChannelKey);
+
+    // 从通道登记表和排队链上摘下该槽位；若它正占用通道，则把通道交给排在后面的tween
+    void UnlinkChannel(int32 SlotIndex);
+
+    // 让轮到的排队tween开始推进
+    void ActivateQueuedTweens();
+
+    // 只需要公共列（Flags、Elapsed等）时按种类取到对应数组
+    FLerpTweenColumns& GetColumns(ELerpTweenKind Kind);
+    const FLerpTweenColumns& GetColumns(ELerpTweenKind Kind) const;
+    FLerpStepColumns& GetStepColumns(ELerpTweenKind Kind);
+
+    // 需要按具体类型操作全部列（如删除行）时使用
+    template <typename FuncType>
+    void VisitTweens(ELerpTweenKind Kind, FuncType&& Func)
+    {
+        switch (Kind)
+        {
+        case ELerpTweenKind::Vector:
+            Func(VectorTweens);
+            break;
+        case ELerpTweenKind::Quat:
+            Func(QuatTweens);
+            break;
+        case ELerpTweenKind::Scalar:
+            Func(ScalarTweens);
+            break;
+        case ELerpTweenKind::Follow:
+            Func(FollowTweens);
+            break;
+        case ELerpTweenKind::Sequence:
+            Func(SequenceTweens);
+            break;
+        case ELerpTweenKind::Spring:
+            Func(SpringTweens);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void PrepareVectorTweens(float DeltaTime);
+    void PrepareQuatTweens(float DeltaTime);
+    void PrepareScalarTweens(float DeltaTime);
+    void PrepareFollowTweens(float DeltaTime);
+    void PrepareSequenceTweens(float DeltaTime);
+    void PrepareSpringTweens(float DeltaTime);
+
+    void EvaluateVectorTweens();
+    void EvaluateQuatTweens();
+    void EvaluateScalarTweens();
+    void EvaluateSpringTweens();
+
+    void ApplyVectorTweens();
+    void ApplyQuatTweens();
+    void ApplyScalarTweens();
+    void ApplyFollowTweens();
+    void ApplySequenceTweens();
+    void ApplySpringTweens();
+
+    // 帧末统一派发进度和结束事件。事件处理中再产生的结束事件留到下一帧
+    void DispatchEvents(bool bStepped);
+
+    // 帧末把各种tween的数量、槽位池占用和本帧启动/结束数发布到stat Lerp和Insights计数器
+    void PublishStats();
+
+    // 把序列从上次求值的位置推进到时间轴上的To，经过的段写到各自的进度，经过的回调依次调用。
+    // 回调里序列被取消时立即停下并返回false
+    bool EvaluateSequenceSpan(FLerpSequence& Sequence, float To);
+
+    FLerpVectorTweens VectorTweens;
+    FLerpQuatTweens QuatTweens;
+    FLerpScalarTweens ScalarTweens;
+    FLerpFollowTweens FollowTweens;
+    FLerpSequenceTweens SequenceTweens;
+    FLerpSpringTweens SpringTweens;
+
+    FLerpSlotPool SlotPool;
+
+    // (目标, 通道) -> 正在推进的tween的槽位
+    TMap<FLerpChannelKey, int32> ChannelOwners;
+
+    // 前一个结束后轮到的排队tween，下一步开始时激活
+    TArray<FLerpHandle> PendingActivations;
+
+    // 批量内核用的临时列，每步复用
+    FLerpStepColumns VectorStep;
+    FLerpStepColumns QuatStep;
+    FLerpStepColumns ScalarStep;
+    FLerpStepColumns FollowStep;
+    FLerpStepColumns SequenceStep;
+    FLerpStepColumns SpringStep;
+    TArray<FVector> StepVectors;
+    TArray<FQuat> StepQuats;
+    TArray<float> StepScalars;
+    // 缓动分桶用，并行推进时每块一份
+    TArray<TArray<int32>> StepEaseRows;
+
+    // 已推进的步数，降频的行按它和槽位错开轮到的步
+    uint32 StepIndex = 0;
+
+    TFunction<int32(const AActor*)> SignificanceFunction;
+    // 距上次评估重要度的时间
+    float SignificanceAge = 0.0f;
+    // 上次评估后是否有降频的行，关闭降频后据此恢复一次
+    bool bHasThrottledTweens = false;
+
+    // 整理时从游戏线程读出的控制台变量，求值可能在后台执行
+    int32 StepParallelThreshold = 0;
+    float StepNlerpMaxAngle = 0.0f;
+
+    // 异步求值
+    FLerpApplyTickFunction ApplyTickFunction;
+    FDelegateHandle PreActorTickHandle;
+    UE::Tasks::FTask StepTask;
+    // 已整理、尚未写回
+    bool bStepPending = false;
+    // 本帧已写回过一步，帧末据此派发进度事件
+    bool bStepApplied = false;
+    // 本帧已由异步模式接管，Tick里不再同步推进
+    uint64 AsyncFrame = 0;
+
+    // Ease为Curve/VectorCurve的tween引用的预采样曲线，按资产共用
+    LerpEasing::FLerpCurveTables CurveTables;
+
+    // Ease为VectorCurve的行数，为0时向量tween跳过逐轴查表
+    int32 NumVectorCurveTweens = 0;
+
+    // 跟随tween和弹簧的目标位置，每步每个Socket只求一次
+    FLerpSocketCache SocketCache;
+
+    // 各Update只计算新值，变换在步末合并后统一写回
+    FLerpTransformBatch TransformBatch;
+
+    // Lerp.UpdateInterval大于0时，攒够间隔再推进一次
+    float PendingDeltaTime = 0.0f;
+
+    int32 NumReapedTweens = 0;
+
+    // 本帧启动、完成、取消和回收的tween数，PublishStats发布后清零
+    int32 FrameStartedTweens = 0;
+    int32 FrameFinishedTweens[3] = {};
+
+    struct FLerpTweenListener
+    {
+        FLerpHandle Handle;
+        FDelegateHandle ListenerHandle;
+        FOnLerpTweenUpdate OnUpdate;
+        FOnLerpTweenFinished OnFinished;
+    };
+
+    struct FLerpFinishEvent
+    {
+        FLerpHandle Handle;
+        ELerpFinishReason Reason = ELerpFinishReason::Completed;
+        // 行删除时就从监听表里取出，槽位随后可能被新的lerp复用
+        TArray<FOnLerpTweenFinished, TInlineAllocator<1>> OnFinished;
+    };
+
+    struct FLerpUpdateEvent
+    {
+        FLerpHandle Handle;
+        FDelegateHandle ListenerHandle;
+        float Progress = 0.0f;
+    };
+
+    FOnLerpFinished LerpFinished;
+
+    // 监听被移除或槽位已被复用时返回空
+    const FLerpTweenListener* FindTweenListener(const FLerpHandle& Handle, FDelegateHandle ListenerHandle) const;
+
+    // 槽位 -> 监听，同一槽位可以有多个
+    TMultiMap<int32, FLerpTweenListener> Listeners;
+
+    TArray<FLerpFinishEvent> PendingFinishEvents;
+    TArray<FLerpFinishEvent> DispatchingFinishEvents;
+    TArray<FLerpUpdateEvent> DispatchingUpdates;
+};
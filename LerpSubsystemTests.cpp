@@ -0,0 +1,84 @@
+#include "LerpSubsystem.h"
+
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // 不通知引擎的临时World，只为取到子系统；测试里直接调用Tick推进，不经过World的tick
+    struct FLerpTestWorld
+    {
+        UWorld* World = nullptr;
+
+        FLerpTestWorld()
+        {
+            World = UWorld::CreateWorld(EWorldType::Game, false);
+        }
+
+        ~FLerpTestWorld()
+        {
+            if (World)
+            {
+                World->DestroyWorld(false);
+            }
+        }
+
+        ULerpSubsystem* GetSubsystem() const
+        {
+            return World ? World->GetSubsystem<ULerpSubsystem>() : nullptr;
+        }
+    };
+}
+
+// 同一句柄上的多个监听互不覆盖，RemoveTweenListener只移除自己那一个。Automation RunTests LerpLibrary.Subsystem
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLerpTweenListenersTest, "LerpLibrary.Subsystem.MultipleListeners", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FLerpTweenListenersTest::RunTest(const FString& Parameters)
+{
+    FLerpTestWorld TestWorld;
+    ULerpSubsystem* LerpSubsystem = TestWorld.GetSubsystem();
+    if (!TestNotNull(TEXT("LerpSubsystem"), LerpSubsystem))
+    {
+        return false;
+    }
+
+    const FLerpHandle Handle = LerpSubsystem->AddCallbackTween(nullptr, NAME_None, 0.0f, 1.0f, 0.1f, [](float) {});
+    TestTrue(TEXT("Handle is active"), LerpSubsystem->IsTweenActive(Handle));
+
+    int32 NumUpdates[3] = {};
+    int32 NumCompleted[3] = {};
+    FDelegateHandle ListenerHandles[3];
+    for (int32 Index = 0; Index < 3; ++Index)
+    {
+        ListenerHandles[Index] = LerpSubsystem->AddTweenListener(
+            Handle,
+            FOnLerpTweenUpdate::CreateLambda([&NumUpdates, Index](float) { ++NumUpdates[Index]; }),
+            FOnLerpTweenFinished::CreateLambda([&NumCompleted, Index](ELerpFinishReason Reason)
+            {
+                NumCompleted[Index] += Reason == ELerpFinishReason::Completed ? 1 : 0;
+            }));
+        TestTrue(FString::Printf(TEXT("Listener %d added"), Index), ListenerHandles[Index].IsValid());
+    }
+
+    // 移除中间那个，其余两个不受影响
+    LerpSubsystem->RemoveTweenListener(Handle, ListenerHandles[1]);
+
+    LerpSubsystem->Tick(0.05f);
+    LerpSubsystem->Tick(0.1f);
+
+    TestFalse(TEXT("Tween finished"), LerpSubsystem->IsTweenActive(Handle));
+    TestTrue(TEXT("First listener updated"), NumUpdates[0] > 0);
+    TestEqual(TEXT("Both listeners updated"), NumUpdates[2], NumUpdates[0]);
+    TestEqual(TEXT("First listener completions"), NumCompleted[0], 1);
+    TestEqual(TEXT("Last listener completions"), NumCompleted[2], 1);
+    TestEqual(TEXT("Removed listener updates"), NumUpdates[1], 0);
+    TestEqual(TEXT("Removed listener completions"), NumCompleted[1], 0);
+
+    // 已结束的句柄不能再添加监听
+    TestFalse(TEXT("Listener on finished handle"), LerpSubsystem->AddTweenListener(Handle, FOnLerpTweenUpdate(), FOnLerpTweenFinished()).IsValid());
+    return true;
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include "LerpTransformBatch.h"
+
+#include "Components/SceneComponent.h"
+#include "Algo/StableSort.h"
+
+void FLerpTransformBatch::SetLocation(USceneComponent* Component, bool bRelative, const FVector& Location)
+{
+    FPendingSpace& Space = FindOrAdd(Component, bRelative);
+    Space.Fields |= ELerpTransformFields::Location;
+    Space.Location = Location;
+}
+
+void FLerpTransformBatch::SetRotation(USceneComponent* Component, bool bRelative, const FQuat& Rotation)
+{
+    FPendingSpace& Space = FindOrAdd(Component, bRelative);
+    Space.Fields |= ELerpTransformFields::Rotation;
+    Space.Rotation = Rotation;
+}
+
+void FLerpTransformBatch::SetScale(USceneComponent* Component, bool bRelative, const FVector& Scale)
+{
+    FPendingSpace& Space = FindOrAdd(Component, bRelative);
+    Space.Fields |= ELerpTransformFields::Scale;
+    Space.Scale = Scale;
+}
+
+FLerpTransformBatch::FPendingSpace& FLerpTransformBatch::FindOrAdd(USceneComponent* Component, bool bRelative)
+{
+    int32 PendingIndex;
+    if (const int32* ExistingIndex = PendingIndices.Find(Component))
+    {
+        PendingIndex = *ExistingIndex;
+    }
+    else
+    {
+        PendingIndex = Pending.AddDefaulted();
+        Pending[PendingIndex].Component = Component;
+        PendingIndices.Add(Component, PendingIndex);
+    }
+
+    FPendingTransform& Transform = Pending[PendingIndex];
+    return bRelative ? Transform.Relative : Transform.World;
+}
+
+void FLerpTransformBatch::Flush()
+{
+    if (Pending.Num() == 0)
+    {
+        return;
+    }
+
+    for (FPendingTransform& Transform : Pending)
+    {
+        Transform.AttachDepth = 0;
+        for (const USceneComponent* Parent = Transform.Component->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+        {
+            ++Transform.AttachDepth;
+        }
+    }
+
+    // 父在前子在后：父组件的传播先完成，子组件最后一次写入即为本帧结果
+    Algo::StableSortBy(Pending, &FPendingTransform::AttachDepth);
+
+    for (FPendingTransform& Transform : Pending)
+    {
+        FoldWorldIntoRelative(Transform.Component, Transform.World, Transform.Relative);
+        ApplyRelative(Transform.Component, Transform.Relative);
+    }
+
+    Pending.Reset();
+    PendingIndices.Reset();
+}
+
+void FLerpTransformBatch::FoldWorldIntoRelative(USceneComponent* Component, const FPendingSpace& World, FPendingSpace& Relative)
+{
+    if (World.Fields == ELerpTransformFields::None)
+    {
+        return;
+    }
+
+    const USceneComponent* Parent = Component->GetAttachParent();
+    const bool bNeedsParentTransform = Parent && EnumHasAnyFlags(World.Fields, ELerpTransformFields::Location | ELerpTransformFields::Scale);
+    const FTransform ParentToWorld = bNeedsParentTransform ? Parent->GetSocketTransform(Component->GetAttachSocketName()) : FTransform::Identity;
+
+    if (EnumHasAnyFlags(World.Fields, ELerpTransformFields::Location))
+    {
+        Relative.Location = Parent && !Component->IsUsingAbsoluteLocation() ? ParentToWorld.InverseTransformPosition(World.Location) : World.Location;
+    }
+    if (EnumHasAnyFlags(World.Fields, ELerpTransformFields::Rotation))
+    {
+        // 负缩放下的镜像等情况交给引擎自己的换算
+        Relative.Rotation = Component->GetRelativeRotationFromWorld(World.Rotation);
+    }
+    if (EnumHasAnyFlags(World.Fields, ELerpTransformFields::Scale))
+    {
+        Relative.Scale = Parent && !Component->IsUsingAbsoluteScale() ? World.Scale * ParentToWorld.GetSafeScaleReciprocal(ParentToWorld.GetScale3D()) : World.Scale;
+    }
+    Relative.Fields |= World.Fields;
+}
+
+void FLerpTransformBatch::ApplyRelative(USceneComponent* Component, const FPendingSpace& Relative)
+{
+    const ELerpTransformFields Fields = Relative.Fields;
+    if (Fields == ELerpTransformFields::None)
+    {
+        return;
+    }
+
+    if (Fields == ELerpTransformFields::Location)
+    {
+        Component->SetRelativeLocation(Relative.Location);
+    }
+    else if (Fields == ELerpTransformFields::Rotation)
+    {
+        Component->SetRelativeRotation(Relative.Rotation);
+    }
+    else if (Fields == (ELerpTransformFields::Location | ELerpTransformFields::Rotation))
+    {
+        Component->SetRelativeLocationAndRotation(Relative.Location, Relative.Rotation);
+    }
+    else if (Fields == ELerpTransformFields::Scale)
+    {
+        Component->SetRelativeScale3D(Relative.Scale);
+    }
+    else
+    {
+        // 缩放和位置/旋转一起写：未写到的分量直接取相对变换本身
+        FTransform NewTransform = Component->GetRelativeTransform();
+        if (EnumHasAnyFlags(Fields, ELerpTransformFields::Location))
+        {
+            NewTransform.SetLocation(Relative.Location);
+        }
+        if (EnumHasAnyFlags(Fields, ELerpTransformFields::Rotation))
+        {
+            NewTransform.SetRotation(Relative.Rotation);
+        }
+        NewTransform.SetScale3D(Relative.Scale);
+        Component->SetRelativeTransform(NewTransform);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USceneComponent;
+
+enum class ELerpTransformFields : uint8
+{
+    None = 0,
+    Location = 1 << 0,
+    Rotation = 1 << 1,
+    Scale = 1 << 2,
+};
+ENUM_CLASS_FLAGS(ELerpTransformFields);
+
+// 一步内对同一组件的所有变换写入先合并，Flush时世界写入换算到相对空间，每个组件只写一次、只传播一次，
+// 并按挂接深度父在前子在后写回，子组件不会在父组件之后又被父组件的传播覆盖一遍。
+// 只写被tween写到的分量，其余分量不经世界空间换算，保持原值
+class FLerpTransformBatch
+{
+public:
+    void SetLocation(USceneComponent* Component, bool bRelative, const FVector& Location);
+    void SetRotation(USceneComponent* Component, bool bRelative, const FQuat& Rotation);
+    void SetScale(USceneComponent* Component, bool bRelative, const FVector& Scale);
+
+    // 写回所有合并后的变换并清空，保留内存供下一步复用
+    void Flush();
+
+    int32 Num() const { return Pending.Num(); }
+
+private:
+    struct FPendingSpace
+    {
+        ELerpTransformFields Fields = ELerpTransformFields::None;
+        FVector Location = FVector::ZeroVector;
+        FQuat Rotation = FQuat::Identity;
+        FVector Scale = FVector::OneVector;
+    };
+
+    struct FPendingTransform
+    {
+        USceneComponent* Component = nullptr;
+        int32 AttachDepth = 0;
+        FPendingSpace World;
+        FPendingSpace Relative;
+    };
+
+    FPendingSpace& FindOrAdd(USceneComponent* Component, bool bRelative);
+
+    // 按父组件（Socket）当前的变换把世界写入换算到相对空间，与SetWorldLocation等内部的换算相同。同一分量世界写入优先
+    static void FoldWorldIntoRelative(USceneComponent* Component, const FPendingSpace& World, FPendingSpace& Relative);
+
+    // 没有缩放时用对应的SetRelative*，缩放和位置/旋转一起写时才整体SetRelativeTransform
+    static void ApplyRelative(USceneComponent* Component, const FPendingSpace& Relative);
+
+    TArray<FPendingTransform> Pending;
+    TMap<USceneComponent*, int32> PendingIndices;
+};
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LerpTypes.h"
+#include "LerpCore/LerpCoreStorage.h"
+
+class AActor;
+class USceneComponent;
+class UCameraComponent;
+class FNumericProperty;
+class UCurveFloat;
+class UCurveVector;
+class FLerpSequence;
+
+// 向量tween写回到组件的哪个属性
+enum class ELerpVectorChannel : uint8
+{
+    WorldLocation,
+    RelativeLocation,
+    WorldScale,
+};
+
+// 旋转tween写回世界旋转还是相对旋转
+enum class ELerpRotationChannel : uint8
+{
+    World,
+    Relative,
+};
+
+// 标量tween的写入目标
+enum class ELerpScalarSink : uint8
+{
+    CameraFOV,
+    FloatPointer,
+    // 通过反射写入UObject上的float/double属性
+    Property,
+    // 调用蓝图委托
+    Setter,
+    // 调用C++ lambda
+    Callback,
+};
+
+// 启动tween时选择的缓动，给了Curve时忽略Ease
+struct FLerpEasing
+{
+    ELerpEase Ease = ELerpEase::Linear;
+    const UCurveFloat* Curve = nullptr;
+    // 逐轴缓动，只对向量tween生效，优先于Curve
+    const UCurveVector* VectorCurve = nullptr;
+
+    FLerpEasing() = default;
+    FLerpEasing(ELerpEase InEase, const UCurveFloat* InCurve = nullptr)
+        : Ease(InEase)
+        , Curve(InCurve)
+    {
+    }
+    explicit FLerpEasing(const UCurveVector* InVectorCurve)
+        : VectorCurve(InVectorCurve)
+    {
+    }
+};
+
+// 目标一律以弱引用保存：目标被销毁后该行在下一步推进时被整行回收，不再解引用
+
+// 位置/缩放
+struct FLerpVectorTweens : public FLerpTweenColumns
+{
+    TArray<TWeakObjectPtr<USceneComponent>> Components;
+    TArray<ELerpVectorChannel> Channels;
+    TArray<FVector> Starts;
+    TArray<FVector> Ends;
+
+    template <typename FuncType>
+    void ForEachColumn(FuncType&& Func)
+    {
+        Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+        Func(Components); Func(Channels); Func(Starts); Func(Ends);
+    }
+};
+
+// 旋转一律以四元数存放，按最短路径Slerp（小角度可改用Nlerp），写回时不再做FRotator转换
+struct FLerpQuatTweens : public FLerpTweenColumns
+{
+    TArray<TWeakObjectPtr<USceneComponent>> Components;
+    TArray<ELerpRotationChannel> Channels;
+    TArray<FQuat> Starts;
+    TArray<FQuat> Ends;
+
+    template <typename FuncType>
+    void ForEachColumn(FuncType&& Func)
+    {
+        Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+        Func(Components); Func(Channels); Func(Starts); Func(Ends);
+    }
+};
+
+// FOV、float及其他标量，按Sinks决定写到哪里，只有对应的列有值
+struct FLerpScalarTweens : public FLerpTweenColumns
+{
+    TArray<ELerpScalarSink> Sinks;
+    TArray<TWeakObjectPtr<UCameraComponent>> Cameras;
+    // float地址和属性地址本身无法判断存活，随其所属对象一起失效
+    TArray<float*> ValuePtrs;
+    TArray<FNumericProperty*> Properties;
+    TArray<void*> PropertyAddresses;
+    TArray<TWeakObjectPtr<UObject>> ValueOwners;
+    TArray<FLerpFloatSetter> Setters;
+    // 调用前先复制一份引用：lambda里再启动lerp可能让数组扩容
+    TArray<TSharedPtr<TFunction<void(float)>, ESPMode::NotThreadSafe>> Callbacks;
+    TArray<float> Starts;
+    TArray<float> Ends;
+
+    template <typename FuncType>
+    void ForEachColumn(FuncType&& Func)
+    {
+        Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+        Func(Sinks); Func(Cameras); Func(ValuePtrs); Func(Properties); Func(PropertyAddresses); Func(ValueOwners);
+        Func(Setters); Func(Callbacks); Func(Starts); Func(Ends);
+    }
+};
+
+// 跟随另一个组件Socket的位移，目标每步重新取
+struct FLerpFollowTweens : public FLerpTweenColumns
+{
+    TArray<TWeakObjectPtr<USceneComponent>> Components;
+    // FLerpSocketCache中的目标下标，同一Socket的tween共用一个
+    TArray<int32> SocketTargets;
+    TArray<FVector> Starts;
+
+    template <typename FuncType>
+    void ForEachColumn(FuncType&& Func)
+    {
+        Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+        Func(Components); Func(SocketTargets); Func(Starts);
+    }
+};
+
+// 临界阻尼弹簧：没有固定时长，带着速度追向目标。
+// 目标固定时停稳后结束；跟随Socket时目标每步重新取，一直持续到取消
+struct FLerpSpringTweens : public FLerpTweenColumns
+{
+    TArray<TWeakObjectPtr<USceneComponent>> Components;
+    TArray<ELerpVectorChannel> Channels;
+    // FLerpSocketCache中的目标下标，目标固定时为INDEX_NONE
+    TArray<int32> SocketTargets;
+    TArray<FVector> Targets;
+    // 弹簧自身的状态，不每步读回组件
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+    // 大致追上目标所需的时间
+    TArray<float> SmoothTimes;
+
+    template <typename FuncType>
+    void ForEachColumn(FuncType&& Func)
+    {
+        Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+        Func(Components); Func(Channels); Func(SocketTargets); Func(Targets); Func(Positions); Func(Velocities); Func(SmoothTimes);
+    }
+};
+
+// 整条时间轴作为一行，Elapsed/Durations是当前这一轮的进度和一轮的时长
+struct FLerpSequenceTweens : public FLerpTweenColumns
+{
+    // 回调里可能取消序列自身，求值期间先复制一份引用
+    TArray<TSharedPtr<FLerpSequence, ESPMode::NotThreadSafe>> Sequences;
+
+    template <typename FuncType>
+    void ForEachColumn(FuncType&& Func)
+    {
+        Func(SlotIndices); Func(Elapsed); Func(Durations); Func(Flags); Func(TimeSources); Func(Eases); Func(CurveTableIndices); Func(Strides); Func(DeferredTimes);
+        Func(Sequences);
+    }
+};
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LerpTypes.generated.h"
+
+class UCurveFloat;
+
+// 对同一目标的同一属性（位置、旋转、缩放、FOV、float）再次发起lerp时的处理方式
+UENUM(BlueprintType)
+enum class ELerpConflict : uint8
+{
+    // 取消正在进行的lerp（及排在其后的），新lerp从当前值开始
+    Replace,
+    // 就地改写正在进行的lerp：从当前值出发，换成新的目标和时长，沿用原句柄
+    Blend,
+    // 排在正在进行的lerp之后，等它结束再从它的终点开始
+    Queue,
+};
+
+// 缓动曲线：把线性推进的进度映射成实际插值用的Alpha
+UENUM(BlueprintType)
+enum class ELerpEase : uint8
+{
+    Linear,
+    QuadIn,
+    QuadOut,
+    QuadInOut,
+    CubicIn,
+    CubicOut,
+    CubicInOut,
+    ExpoIn,
+    ExpoOut,
+    ExpoInOut,
+    // 先反向冲出一点再前进 / 越过终点再回来
+    BackIn,
+    BackOut,
+    BackInOut,
+    ElasticIn,
+    ElasticOut,
+    ElasticInOut,
+    BounceIn,
+    BounceOut,
+    BounceInOut,
+    // 保持起点，到时长结束时直接跳到终点
+    Step,
+    // 由曲线资产驱动，启动函数给了EaseCurve时自动使用
+    Curve UMETA(Hidden),
+    // 由UCurveVector逐轴驱动，只用于向量tween
+    VectorCurve UMETA(Hidden),
+};
+
+// lerp结束的原因
+UENUM(BlueprintType)
+enum class ELerpFinishReason : uint8
+{
+    // 走完全程，或被FinishLerp直接完成
+    Completed,
+    // 被取消，或被同一属性上新的lerp替换
+    Cancelled,
+    // 目标被销毁，随之回收
+    TargetDestroyed,
+};
+
+// lerp是否只影响表现。专用服务器和无法渲染的进程里，表现类lerp按Lerp.HeadlessCosmetic直接完成或丢弃
+UENUM(BlueprintType)
+enum class ELerpRelevance : uint8
+{
+    // 按种类判断：相机FOV算表现，其余算权威
+    Auto,
+    // 只影响画面
+    Cosmetic,
+    // 影响玩法（碰撞、判定等），任何进程里都照常推进
+    Authoritative,
+};
+
+// 成组启动时各元素开始时间的错开方式
+UENUM(BlueprintType)
+enum class ELerpStaggerMode : uint8
+{
+    // 按下标依次错开
+    Linear,
+    // 按网格（每行GridColumns个，逐行排列）上到Origin格的距离错开
+    Grid,
+    // 按下标到Origin的距离向两侧错开
+    Radial,
+    // 由曲线给出：横轴为归一化下标(0~1)，纵轴为该元素的延迟秒数
+    Curve,
+};
+
+// 一组lerp的开始时间错开参数，每个元素得到一个启动延迟，不为每个元素单独计时
+USTRUCT(BlueprintType)
+struct LUXUN2024_API FLerpStagger
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lerp")
+    ELerpStaggerMode Mode = ELerpStaggerMode::Linear;
+
+    // 相邻元素（网格上相距一格）开始时间的间隔，秒。Curve模式不使用
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lerp")
+    float Interval = 0.02f;
+
+    // 整组统一再推迟的时间，秒
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lerp")
+    float StartDelay = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lerp", meta = (ClampMin = "1"))
+    int32 GridColumns = 1;
+
+    // Grid和Radial从这个下标的元素开始向外扩散
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lerp", meta = (ClampMin = "0"))
+    int32 Origin = 0;
+
+    // 反过来：原本最后开始的元素最先开始
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lerp")
+    bool bReverse = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lerp")
+    UCurveFloat* Curve = nullptr;
+};
+
+// 逐步接收lerp结果的蓝图委托
+DECLARE_DYNAMIC_DELEGATE_OneParam(FLerpFloatSetter, float, Value);
+
+// 启动lerp时返回的轻量句柄：槽位下标 + 代数。槽位被回收复用后代数递增，旧句柄自然失效
+USTRUCT(BlueprintType)
+struct LUXUN2024_API FLerpHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Index = INDEX_NONE;
+
+    UPROPERTY()
+    uint32 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    void Invalidate() { *this = FLerpHandle(); }
+
+    bool operator==(const FLerpHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    bool operator!=(const FLerpHandle& Other) const { return !(*this == Other); }
+
+    friend uint32 GetTypeHash(const FLerpHandle& Handle)
+    {
+        return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+    }
+};